@@ -26,10 +26,90 @@
 
 
 #define GPIO_OUTPUT_INITIAL_STATE  LOW  /* The initial state of O/P Device */
+#define GPIO_NUMBER_OF_PORTS       5    /* PORTA..PORTE */
 
-/* Macro function for debouncing */
-#define HAL_GPIO_DEBOUNCE(PORT_ADDRESS,PIN_NUMBER,IN_VALUE)  \
-while(((HAL_RegisterRead(PORT_ADDRESS) & (1<<PIN_NUMBER)) >> PIN_NUMBER)==IN_VALUE);
+#define PORT_DIRECTION_OFFSET 0x12  /* The difference of the addressees
+                                       between PORTx and TRISx */
+#define PORT_LATCH_OFFSET 0x09      /* The difference of the addressees
+                                       between PORTx and LATx */
+
+/* Outputs are written to LATx, a pin is read from PORTx */
+#define GPIO_PORT_INDEX(PORT_ADDRESS)  ((PORT_ADDRESS)-PORTA_BASE_ADDRESS)
+#define GPIO_PORT_MASK(PORT_ADDRESS)   (1<<GPIO_PORT_INDEX(PORT_ADDRESS))
+
+/* Ports with a RAM shadow of LATx (0 => no shadow). Outputs of these ports */
+/* are computed in the shadow and written with one LATx write, no SFR is  */
+/* read back. Only ports whose latch is written by this driver alone can  */
+/* be listed (PORTD is shared with the LCD driver).                      */
+#ifndef GPIO_LATCH_SHADOW_PORTS
+#define GPIO_LATCH_SHADOW_PORTS  (GPIO_PORT_MASK(PORTB_BASE_ADDRESS) | \
+                                  GPIO_PORT_MASK(PORTC_BASE_ADDRESS))
+#endif
+#define GPIO_PORT_SHADOWED(PORT_ADDRESS) \
+(GPIO_LATCH_SHADOW_PORTS & GPIO_PORT_MASK(PORT_ADDRESS))
+
+#define GPIO_ALL_PORTS_MASK  ((1<<GPIO_NUMBER_OF_PORTS)-1)
+
+/* Port snapshot: GPIO_SnapshotTake reads the ports once, then all queries */
+/* of a pass are answered from RAM with the same view of the inputs.      */
+#define GPIO_SNAPSHOT_IS_HIGH(PIN_DEF)      GPIO_SNAPSHOT_IS_HIGH_(PIN_DEF)
+#define GPIO_SNAPSHOT_READ(PIN_DEF)         GPIO_SNAPSHOT_READ_(PIN_DEF)
+#define GPIO_SNAPSHOT_IS_HIGH_(PORT,PIN)    \
+(GPIO_PortSnapshot[GPIO_PORT_INDEX(PORT)] & (1<<(PIN)))
+#define GPIO_SNAPSHOT_READ_(PORT,PIN)       (GPIO_SNAPSHOT_IS_HIGH_(PORT,PIN) ? HIGH : LOW)
+
+/* Compile-time resolved pin API */
+/* A pin is defined once as "PORTx_BASE_ADDRESS,PIN_n", for example:       */
+/*      #define HEATER_PIN  PORTB_BASE_ADDRESS,PIN_7                       */
+/* Port and pin are constants so every macro is one BSF/BCF/BTG on LATx   */
+/* (or a bit operation on the shadow and one LATx write) or one BTFSC on  */
+/* PORTx, no pointer and no GPIO_CheckError. The pin must be configured   */
+/* by GPIO_DeviceInit first and checked by GPIO_PIN_CHECK at compile time. */
+#define GPIO_PIN_SET(PIN_DEF)               GPIO_PIN_SET_(PIN_DEF)
+#define GPIO_PIN_CLEAR(PIN_DEF)             GPIO_PIN_CLEAR_(PIN_DEF)
+#define GPIO_PIN_TOGGLE(PIN_DEF)            GPIO_PIN_TOGGLE_(PIN_DEF)
+#define GPIO_PIN_ASSIGN(PIN_DEF,STATUS)     GPIO_PIN_ASSIGN_(PIN_DEF,STATUS)
+/* Non zero if the pin is HIGH (BTFSC when used in a condition) */
+#define GPIO_PIN_IS_HIGH(PIN_DEF)           GPIO_PIN_IS_HIGH_(PIN_DEF)
+/* HIGH or LOW as HAL_GPIO_StatusType */
+#define GPIO_PIN_READ(PIN_DEF)              GPIO_PIN_READ_(PIN_DEF)
+/* Fails the build if the port or pin of PIN_DEF is out of range */
+#define GPIO_PIN_CHECK(NAME,PIN_DEF)        GPIO_PIN_CHECK_(NAME,PIN_DEF)
+
+/* Expansion helpers, PIN_DEF is split in port and pin here */
+#define GPIO_LATCH_SHADOW(PORT)             GPIO_LatchShadow[GPIO_PORT_INDEX(PORT)]
+#define GPIO_LATCH_FLUSH(PORT)              \
+HAL_RegisterWrite((PORT)+PORT_LATCH_OFFSET,GPIO_LATCH_SHADOW(PORT))
+#define GPIO_PIN_SET_(PORT,PIN)             do{                                 \
+      if(GPIO_PORT_SHADOWED(PORT)) {                                          \
+            GPIO_LATCH_SHADOW(PORT) |= (1<<(PIN));                            \
+            GPIO_LATCH_FLUSH(PORT);                                           \
+      }                                                                       \
+      else  HAL_RegisterSetBit((PORT)+PORT_LATCH_OFFSET,PIN);                 \
+}while(0)
+#define GPIO_PIN_CLEAR_(PORT,PIN)           do{                                 \
+      if(GPIO_PORT_SHADOWED(PORT)) {                                          \
+            GPIO_LATCH_SHADOW(PORT) &=~ (1<<(PIN));                           \
+            GPIO_LATCH_FLUSH(PORT);                                           \
+      }                                                                       \
+      else  HAL_RegisterClearBit((PORT)+PORT_LATCH_OFFSET,PIN);               \
+}while(0)
+#define GPIO_PIN_TOGGLE_(PORT,PIN)          do{                                 \
+      if(GPIO_PORT_SHADOWED(PORT)) {                                          \
+            GPIO_LATCH_SHADOW(PORT) ^= (1<<(PIN));                            \
+            GPIO_LATCH_FLUSH(PORT);                                           \
+      }                                                                       \
+      else  HAL_RegisterToggleBit((PORT)+PORT_LATCH_OFFSET,PIN);              \
+}while(0)
+#define GPIO_PIN_ASSIGN_(PORT,PIN,STATUS)   do{                                 \
+      if(STATUS)  GPIO_PIN_SET_(PORT,PIN);                                    \
+      else        GPIO_PIN_CLEAR_(PORT,PIN);                                  \
+}while(0)
+#define GPIO_PIN_IS_HIGH_(PORT,PIN)         (HAL_RegisterRead(PORT) & (1<<(PIN)))
+#define GPIO_PIN_READ_(PORT,PIN)            (GPIO_PIN_IS_HIGH_(PORT,PIN) ? HIGH : LOW)
+#define GPIO_PIN_CHECK_(NAME,PORT,PIN)      \
+typedef char GPIO_PinCheck_##NAME[((PORT)>=PORTA_BASE_ADDRESS && \
+                                   (PORT)<=PORTE_BASE_ADDRESS && (PIN)<8) ? 1 : -1]
 
 /* User-defined data-types Defination */
 
@@ -76,6 +156,62 @@ typedef struct {
       HAL_GPIO_DeviceDirectionType deviceDirection;
 } HAL_GPIO_DeviceType;
 
+/*****************************************************************************/
+/** Description: This is a validated GPIO device, it is filled once by      **/
+/**              GPIO_DeviceInitHandle so GPIO_Handle* calls need no check, **/
+/**              shift or address offset.                                   **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - portAddress       => The address of PORTx (pin reading).    **/
+/**           - latchAddress      => The address of LATx (pin writing).     **/
+/**           - directionAddress  => The address of TRISx.                  **/
+/**           - pinMask           => The mask of the device pin.            **/
+/**           - latchShadow       => RAM copy of LATx, NULL_PTR if the port **/
+/**                                  is not in GPIO_LATCH_SHADOW_PORTS.     **/
+/*****************************************************************************/
+typedef struct {
+      uint16                       portAddress;
+      uint16                       latchAddress;
+      uint16                       directionAddress;
+      uint8                        pinMask;
+      uint8 *                      latchShadow;
+} HAL_GPIO_HandleType;
+
+/*****************************************************************************/
+/** Description: This is to hold the pins of a group on one port.           **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - portBaseAddress  => The address of the port.                **/
+/**           - pinsMask         => The pins of the group on this port.     **/
+/*****************************************************************************/
+typedef struct {
+      uint16                       portBaseAddress;
+      uint8                        pinsMask;
+} HAL_GPIO_PortMaskType;
+
+/*****************************************************************************/
+/** Description: This is to switch a set of output devices together, it is  **/
+/**              filled once by GPIO_GroupInit.                             **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - portsNumber  => Number of ports used by the group.          **/
+/**           - ports        => Mask of the group on every used port.       **/
+/*****************************************************************************/
+typedef struct {
+      uint8                        portsNumber;
+      HAL_GPIO_PortMaskType        ports[GPIO_NUMBER_OF_PORTS];
+} HAL_GPIO_GroupType;
+
+/* Externed variables */
+/* RAM copy of LATx of the ports in GPIO_LATCH_SHADOW_PORTS, loaded from */
+/* LATx by GPIO_DeviceInit                                               */
+extern uint8 GPIO_LatchShadow[GPIO_NUMBER_OF_PORTS];
+/* PORTx levels latched by the last GPIO_SnapshotTake */
+extern uint8 GPIO_PortSnapshot[GPIO_NUMBER_OF_PORTS];
+
 /* Functions Prototypes */
 /**
   * @brief        By a call to GPIO_DeviceInit The passed GPIO device will be 
@@ -138,5 +274,100 @@ Std_ErrorType GPIO_DeviceAssignStatus(HAL_GPIO_DeviceType * GPIO_Device,
 Std_ErrorType GPIO_DeviceGetRead(HAL_GPIO_DeviceType * GPIO_Device,
                                  HAL_GPIO_StatusType * ReturnStatus);
 
+/**
+  * @brief        By a call to GPIO_DeviceInitHandle The passed GPIO device will be
+  *                        initialized by GPIO_DeviceInit and the handle filled with
+  *                        its precomputed mask and PORT/LAT/TRIS addresses.
+  *        @param[in]        GPIO_Device Pointer to HAL_GPIO_DeviceType which is filled with
+  *                                needed configurations defined HAL_GPIO_DeviceType structure.
+  *        @param[out]        GPIO_Handle Pointer to HAL_GPIO_HandleType to be filled.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType GPIO_DeviceInitHandle(HAL_GPIO_DeviceType * GPIO_Device,
+                                    HAL_GPIO_HandleType * GPIO_Handle);
+
+/**
+  * @brief        By a call to GPIO_HandleSet the pin of the handle will be HIGH.
+  *                        No check, the handle is validated at init.
+  *        @param        GPIO_Handle Pointer to HAL_GPIO_HandleType filled by GPIO_DeviceInitHandle.
+  */
+void GPIO_HandleSet(const HAL_GPIO_HandleType * GPIO_Handle);
+
+/**
+  * @brief        By a call to GPIO_HandleClear the pin of the handle will be LOW.
+  *                        No check, the handle is validated at init.
+  *        @param        GPIO_Handle Pointer to HAL_GPIO_HandleType filled by GPIO_DeviceInitHandle.
+  */
+void GPIO_HandleClear(const HAL_GPIO_HandleType * GPIO_Handle);
+
+/**
+  * @brief        By a call to GPIO_HandleToggle the latch of the handle pin will be
+  *                        inverted. No check, the handle is validated at init.
+  *        @param        GPIO_Handle Pointer to HAL_GPIO_HandleType filled by GPIO_DeviceInitHandle.
+  */
+void GPIO_HandleToggle(const HAL_GPIO_HandleType * GPIO_Handle);
+
+/**
+  * @brief        By a call to GPIO_HandleGetRead the pin of the handle will be read.
+  *                        No check, the handle is validated at init.
+  *        @param        GPIO_Handle Pointer to HAL_GPIO_HandleType filled by GPIO_DeviceInitHandle.
+  *        @return        HIGH or LOW.
+  */
+HAL_GPIO_StatusType GPIO_HandleGetRead(const HAL_GPIO_HandleType * GPIO_Handle);
+
+/**
+  * @brief        By a call to GPIO_HandleGetSnapshot the pin of the handle will be
+  *                        read from the last snapshot, no SFR is read.
+  *        @param        GPIO_Handle Pointer to HAL_GPIO_HandleType filled by GPIO_DeviceInitHandle.
+  *        @return        HIGH or LOW.
+  */
+HAL_GPIO_StatusType GPIO_HandleGetSnapshot(const HAL_GPIO_HandleType * GPIO_Handle);
+
+/**
+  * @brief        By a call to GPIO_SnapshotTake every port in PortsMask will be
+  *                        read once into GPIO_PortSnapshot.
+  *        @param        PortsMask GPIO_PORT_MASK of the ports to be latched
+  *                        (GPIO_ALL_PORTS_MASK for PORTA..PORTE).
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType GPIO_SnapshotTake(uint8 PortsMask);
+
+/**
+  * @brief        By a call to GPIO_GroupInit The passed output devices will be
+  *                        checked once and collected in one mask per port.
+  *        @param[out]        GPIO_Group Pointer to HAL_GPIO_GroupType to be filled.
+  *        @param[in]        GPIO_Devices Array of pointers to initialized output devices.
+  *        @param[in]        DevicesNumber Number of devices in GPIO_Devices.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType GPIO_GroupInit(HAL_GPIO_GroupType * GPIO_Group,
+                             HAL_GPIO_DeviceType * const * GPIO_Devices,
+                             uint8 DevicesNumber);
+
+/**
+  * @brief        By a call to GPIO_GroupAssignStatus all devices of the group
+  *                        will be setted by GPIO_DeviceStatus with one masked
+  *                        write per port.
+  *        @param        GPIO_Group Pointer to HAL_GPIO_GroupType filled by GPIO_GroupInit.
+  *        @param        GPIO_DeviceStatus The status needed to be assigned to devices.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType GPIO_GroupAssignStatus(HAL_GPIO_GroupType * GPIO_Group,
+                                     HAL_GPIO_StatusType GPIO_DeviceStatus);
+
+/**
+  * @brief        By a call to GPIO_GroupSet all devices of the group will be set.
+  *        @param        GPIO_Group Pointer to HAL_GPIO_GroupType filled by GPIO_GroupInit.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+#define GPIO_GroupSet(GPIO_Group)    GPIO_GroupAssignStatus((GPIO_Group),HIGH)
+
+/**
+  * @brief        By a call to GPIO_GroupClear all devices of the group will be cleared.
+  *        @param        GPIO_Group Pointer to HAL_GPIO_GroupType filled by GPIO_GroupInit.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+#define GPIO_GroupClear(GPIO_Group)  GPIO_GroupAssignStatus((GPIO_Group),LOW)
+
 
 #endif  /*_HAL_GPIO_H_*/
\ No newline at end of file
@@ -19,41 +19,14 @@
 #define INT1_PIN   PIN_1				/* Interrupt 1 pin number */
 #define INT2_PIN   PIN_2				/* Interrupt 2 pin number */
 
-/* Comment the next line if you will handle the ISR */
-//#define DRIVER_HANDLE_ISR
-
-#ifdef        DRIVER_HANDLE_ISR
-#define NUMBER_OF_ACTIVE_INTERRUPTS 20
-#endif
-
-/* Active Interrupts -for interrupt handeling- */
-/*#define INTERRUPT_EXT_0
-#define INTERRUPT_EXT_1
-#define INTERRUPT_EXT_2
-#define RB_PORT_CHANGE_INTERRUPT
-#define TIMER_0_INTERRUPT
-#define TIMER_1_INTERRUPT
-#define TIMER_2_INTERRUPT
-#define TMR3_INTERRUPT
-#define CCP1_INTERRUPT
-#define CCP2_INTERRUPT
-#define EUSART_TRANSMIT_INTERRUPT
-#define EUSART_RECEIVE_INTERRUPT
-#define MASTER_SNCHRONOUS_SERIAL_PORT_INTERRUPT
-#define A_D_CONVERTER_INTERRUPT
-#define PARALLEL_SLAVE_PORT_READ_WRITE_INTERRUPT
-#define HIGH_LOW_VOLTAGE_DETECT_INTERRUPT
-#define BUS_COLLISION_INTERRUPT
-#define DATA_EEPROM_FLASH_WRITE_OPERATION_INTERRUPT
-#define COMPARATOR_INTERRUPT
-#define OSCILLATOR_FAIL_INTERRUPT*/
+#define INTERRUPT_SOURCES_NUMBER 20  /* Values of InterruptSourceType */
 
 /*****************************************************************************/
 /** Description: This is to indicate the index of each interrupt source.    **/
 /**                                                                         **/
 /** Type: Enumeration.                                                      **/
 /**                                                                         **/
-/** Values: From 0x00 to (NUMBER_OF_ACTIVE_INTERRUPTS-1) and they must be   **/
+/** Values: From 0x00 to (INTERRUPT_SOURCES_NUMBER-1) and they must be      **/
 /**         increased by 1.                                                 **/
 /*****************************************************************************/
 typedef enum { INT_EXT0 =0x00, /* External Interrupt 0 */
@@ -87,36 +60,54 @@ typedef enum { INT_EXT0 =0x00, /* External Interrupt 0 */
                }InterruptSourceType;
 
 /*****************************************************************************/
-/** Description: This is to indicate if the interrupt  happened or not.     **/
+/** Description: This is the callback of an interrupt source, called from   **/
+/**              the interrupt routine of its priority by the dispatch,     **/
+/**              the flag of the source already cleared.                    **/
+/**                                                                         **/
+/** Type: Pointer to function.                                              **/
+/*****************************************************************************/
+typedef void (*InterruptCallbackType)(void);
+
+/*****************************************************************************/
+/** Description: This is to select the edge of an external interrupt.      **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: -  INT_FALLING_EDGE  => 0 -> HIGH to LOW (press of a button    **/
+/**                                     or key pulled up).                  **/
+/**         -  INT_RISING_EDGE   => 1 -> LOW to HIGH (reset value).         **/
+/*****************************************************************************/
+typedef enum{
+             INT_FALLING_EDGE=0,
+             INT_RISING_EDGE=1
+}InterruptEdgeType;
+
+/*****************************************************************************/
+/** Description: This is to select the vector of an interrupt source once   **/
+/**              InterruptHandler_EnablePriority has set IPEN.              **/
 /**                                                                         **/
 /** Type: Enumeration.                                                      **/
 /**                                                                         **/
-/** Values: -  EXT_INT_NOT_HAPPENED  => 0 -> No Interrupt.                  **/
-/**         -  EXT_INT_HAPPENED      => 1 -> Interrupt happened.            **/
+/** Values: -  INT_LOW_PRIORITY  => 0 -> Vector 0x18, interrupt_low().      **/
+/**         -  INT_HIGH_PRIORITY => 1 -> Vector 0x08, interrupt(), it can   **/
+/**                                      interrupt the low one (reset       **/
+/**                                      value).                            **/
 /*****************************************************************************/
 typedef enum{
-             INT_NOT_HAPPENED=0,
-             INT_HAPPENED=1
-}InterruptOcurrancyType;
+             INT_LOW_PRIORITY=0,
+             INT_HIGH_PRIORITY=1
+}InterruptPriorityType;
 
 /* Functions prototypes */
 /**
-  * @brief        By a call to By a call to InterruptHandler_EnableInterrupt it 
-  *                        enables specific interrupt source passed its identifier. 
-  *        @param        GPIO_Device Enum value defined as InterruptSourceType to know 
-  *                        which interrupt source you want to enable. [Optional if you 
-  *                        defined DRIVER_HANDLE_ISR in HAL_InterruptHandler.h] .
-  *        @param        flagPointer Pointer to flag with type of InterruptOcurrancyType 
-  *                        to set if the interrupt happens "could be replaced with pointer 
-  *                        to function to call (call-back function)" .  
+  * @brief        By a call to InterruptHandler_EnableInterrupt it enables 
+  *                        specific interrupt source passed its identifier, and the 
+  *                        global interrupt. 
+  *        @param        InterruptSource Enum value defined as InterruptSourceType to 
+  *                        know which interrupt source you want to enable.
   *        @return        None.
   */
-#ifdef DRIVER_HANDLE_ISR
-void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource,
-                                      InterruptOcurrancyType * flagPointer);
-#else
 void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource);
-#endif
 
 /**
   * @brief        By a call to InterruptHandler_DisableInterrupt it disables 
@@ -127,6 +118,26 @@ void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource);
   */
 void InterruptHandler_DisableInterrupt(InterruptSourceType InterruptSource);
 
+/**
+  * @brief        By a call to InterruptHandler_ClearFlag it clears the flag of 
+  *                        specific interrupt source passed its identifier (PORTB 
+  *                        is read first for INT_RB). 
+  *        @param        InterruptSource Enum value defined as InterruptSourceType to 
+  *                        know which interrupt flag you want to clear.
+  *        @return        None.
+  */
+void InterruptHandler_ClearFlag(InterruptSourceType InterruptSource);
+
+/**
+  * @brief        By a call to InterruptHandler_SetEdge it selects the edge of 
+  *                        INT0, INT1 or INT2. 
+  *        @param        InterruptSource INT_EXT0, INT_EXT1 or INT_EXT2.
+  *        @param        Edge Enum value defined as InterruptEdgeType.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType InterruptHandler_SetEdge(InterruptSourceType InterruptSource,
+                                       InterruptEdgeType Edge);
+
 /**
   * @brief        By a call to InterruptHandler_DisableGlobalInterrupt it disables 
   *                        global interrupt. 
@@ -142,4 +153,63 @@ void InterruptHandler_DisableGlobalInterrupt(void);
   *        @return        None.
   */
 void InterruptHandler_EnbleGlobalInterrupt(void);
+
+/**
+  * @brief        By a call to InterruptHandler_SetCallback the callback of 
+  *                        specific interrupt source is registered, NULL_PTR removes 
+  *                        it (the flag is still cleared). 
+  *        @note        Register it before the source is enabled.
+  *        @param        InterruptSource Enum value defined as InterruptSourceType.
+  *        @param        Callback Function called when the source interrupts.
+  *        @return        STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType InterruptHandler_SetCallback(InterruptSourceType InterruptSource,
+                                           InterruptCallbackType Callback);
+
+/**
+  * @brief        By a call to InterruptHandler_EnablePriority IPEN is set and 
+  *                        every source but INT_EXT0 (no priority bit, always high) 
+  *                        goes on low priority. 
+  *        @note        Call it before any source is enabled, then raise the 
+  *                        sources which can't wait with InterruptHandler_SetPriority. 
+  *        @param        None.
+  *        @return        None.
+  */
+void InterruptHandler_EnablePriority(void);
+
+/**
+  * @brief        By a call to InterruptHandler_SetPriority specific interrupt 
+  *                        source is serviced by the high or the low vector. 
+  *        @note        Select it while the source is disabled. 
+  *        @param        InterruptSource Enum value defined as InterruptSourceType.
+  *        @param        Priority Enum value defined as InterruptPriorityType.
+  *        @return        STD_OK if no Error and E_NOT_OK if IPEN isn't set or 
+  *                        INT_EXT0 is put on low priority.
+  */
+Std_ErrorType InterruptHandler_SetPriority(InterruptSourceType InterruptSource,
+                                           InterruptPriorityType Priority);
+
+/**
+  * @brief        By a call to InterruptHandler_DispatchHigh every pending high 
+  *                        priority source (flag and enable set) of INTCON, INTCON3, 
+  *                        PIR1 and PIR2 has its flag cleared and its callback 
+  *                        called. Call it from interrupt() only. While IPEN is 
+  *                        clear it services every source. 
+  *        @note        Only the registers with a high priority source are read, 
+  *                        once, then the cost is per pending source: lowest bit 
+  *                        first in each register. 
+  *        @param        None.
+  *        @return        None.
+  */
+void InterruptHandler_DispatchHigh(void);
+
+/**
+  * @brief        By a call to InterruptHandler_DispatchLow every pending low 
+  *                        priority source is serviced as by 
+  *                        InterruptHandler_DispatchHigh. Call it from 
+  *                        interrupt_low() only. 
+  *        @param        None.
+  *        @return        None.
+  */
+void InterruptHandler_DispatchLow(void);
 #endif  /* _HAL_INTERRUPT_HANDLER_H_ */
\ No newline at end of file
@@ -14,6 +14,30 @@
 #include "StdTypes.h"
 
 /* Macros */
+#ifdef HOST_SIMULATION
+/* Host build: all accesses go to the simulated register file (Sim_Core.c) */
+#include "Sim_Core.h"
+// Read from 8 bits Register
+#define HAL_RegisterRead(REG_ADDRESS)  Sim_RegisterRead(REG_ADDRESS)
+// Write to 8 bits Register
+#define HAL_RegisterWrite(REG_ADDRESS,__VALUE)  Sim_RegisterWrite((REG_ADDRESS),(__VALUE))
+// Set specific bit in 8 bits Register
+#define HAL_RegisterSetBit(REG_ADDRESS,BIT_NO)  \
+ Sim_RegisterSetBit((REG_ADDRESS),(BIT_NO))
+// Clear Specific bit in 8 bits Register
+#define HAL_RegisterClearBit(REG_ADDRESS,BIT_NO)  \
+ Sim_RegisterClearBit((REG_ADDRESS),(BIT_NO))
+// Toggle Specific bit in 8 bits Register
+#define HAL_RegisterToggleBit(REG_ADDRESS,BIT_NO)  \
+ Sim_RegisterToggleBit((REG_ADDRESS),(BIT_NO))
+// Set/Clear/Toggle the bits of a mask in 8 bits Register
+#define HAL_RegisterSetMask(REG_ADDRESS,MASK)  \
+ Sim_RegisterSetMask((REG_ADDRESS),(MASK))
+#define HAL_RegisterClearMask(REG_ADDRESS,MASK)  \
+ Sim_RegisterClearMask((REG_ADDRESS),(MASK))
+#define HAL_RegisterToggleMask(REG_ADDRESS,MASK)  \
+ Sim_RegisterToggleMask((REG_ADDRESS),(MASK))
+#else
 // Read from 8 bits Register
 #define HAL_RegisterRead(REG_ADDRESS)  (*((vuint8_t * const)(REG_ADDRESS)))
 // Write to 8 bits Register
@@ -24,9 +48,20 @@
 // Clear Specific bit in 8 bits Register
 #define HAL_RegisterClearBit(REG_ADDRESS,BIT_NO)  \
  *((vuint8_t * const)(REG_ADDRESS)) &=~ (1<<BIT_NO)
+// Toggle Specific bit in 8 bits Register
+#define HAL_RegisterToggleBit(REG_ADDRESS,BIT_NO)  \
+ *((vuint8_t * const)(REG_ADDRESS)) ^= (1<<BIT_NO)
+// Set/Clear/Toggle the bits of a mask in 8 bits Register
+#define HAL_RegisterSetMask(REG_ADDRESS,MASK)  \
+ *((vuint8_t * const)(REG_ADDRESS)) |= (MASK)
+#define HAL_RegisterClearMask(REG_ADDRESS,MASK)  \
+ *((vuint8_t * const)(REG_ADDRESS)) &=~ (MASK)
+#define HAL_RegisterToggleMask(REG_ADDRESS,MASK)  \
+ *((vuint8_t * const)(REG_ADDRESS)) ^= (MASK)
+#endif
 // Write specific value to specific bit in 8 bits Register
 #define HAL_RegisterAssignBit(REG_ADDRESS,BIT_NO,__VALUE) \
-(_VALUE ?  HAL_RegisterSetBit(REG_ADDRESS,BIT_NO) : HAL_RegisterClearBit(REG_ADDRESS,BIT_NO))
+(__VALUE ?  HAL_RegisterSetBit(REG_ADDRESS,BIT_NO) : HAL_RegisterClearBit(REG_ADDRESS,BIT_NO))
 // Pins defination
 #define PIN_0 0
 #define PIN_1 1
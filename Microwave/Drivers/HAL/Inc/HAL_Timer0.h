@@ -15,10 +15,67 @@
 /* Inclusion */
 #include "StdTypes.h"
 #include "HAL_RegisterAccess.h"
+#include "Timer0_Config.h"  /* Compile-time configuration */
 
 /* Macros */
 #define TIMER0L_Reg 0x0FD6 /* Timer0L Register base address */
 #define TIMER0H_Reg 0x0FD7 /* Timer0H Register base address */
+/* Tcy from the TMR0L read to the TMR0L write of HAL_Timer0_reload (3     */
+/* register accesses) + 2 Tcy the increment is inhibited after the write, */
+/* check it in the listing. Only added with TIMER0_PRESCALER_OFF.         */
+#ifndef TIMER0_RELOAD_CYCLES
+#define TIMER0_RELOAD_CYCLES 8
+#endif
+
+/* Smallest prescaler which counts TCY cycles in one overflow of the 16   */
+/* bits timer (0 => too long for 1:256) and its T0CON bits.               */
+#define TIMER0_PRESCALE_OF(TCY)                                               \
+((TCY) <=     0x10000UL ?   1 : (TCY) <=   2*0x10000UL ?   2 :                 \
+ (TCY) <=   4*0x10000UL ?   4 : (TCY) <=   8*0x10000UL ?   8 :                 \
+ (TCY) <=  16*0x10000UL ?  16 : (TCY) <=  32*0x10000UL ?  32 :                 \
+ (TCY) <=  64*0x10000UL ?  64 : (TCY) <= 128*0x10000UL ? 128 :                 \
+ (TCY) <= 256*0x10000UL ? 256 : 0)
+#define TIMER0_PS_BITS_OF(PRESCALE)  /* PSA: prescaler not assigned */        \
+((PRESCALE) ==   1 ? 0x08 : (PRESCALE) ==   2 ? 0x00 : (PRESCALE) ==  4 ? 0x01 : \
+ (PRESCALE) ==   8 ? 0x02 : (PRESCALE) ==  16 ? 0x03 : (PRESCALE) == 32 ? 0x04 : \
+ (PRESCALE) ==  64 ? 0x05 : (PRESCALE) == 128 ? 0x06 : 0x07)
+
+/* Compile-time configuration of HAL_Timer0_initStatic, 16 bits timer:    */
+/* the smallest prescaler which counts TIMER0_CONFIG_PERIOD_US in one     */
+/* overflow, the reload and the T0CON byte. Up to 32.768 ms at 8 MHz the  */
+/* prescaler is off and HAL_Timer0_reload is drift free. The period       */
+/* stretched by HAL_Timer0_extend, up to TIMER0_CONFIG_MAX_PERIOD_US, has */
+/* its own prescaler, the tick doesn't take it.                           */
+#if (TIMER0_CONFIG_FOSC_HZ % 4000UL) != 0
+#error "TIMER0_CONFIG_FOSC_HZ must be whole Tcy per ms"
+#endif
+#define TIMER0_CONFIG_TCY_PER_MS     (TIMER0_CONFIG_FOSC_HZ/4000UL)
+#if ((TIMER0_CONFIG_TCY_PER_MS*TIMER0_CONFIG_PERIOD_US) % 1000UL) != 0
+#error "TIMER0_CONFIG_PERIOD_US isn't whole Tcy"
+#endif
+#define TIMER0_CONFIG_PERIOD_TCY     (TIMER0_CONFIG_TCY_PER_MS*TIMER0_CONFIG_PERIOD_US/1000UL)
+#ifndef TIMER0_CONFIG_MAX_PERIOD_US
+#define TIMER0_CONFIG_MAX_PERIOD_US  TIMER0_CONFIG_PERIOD_US  /* No stretch */
+#endif
+#define TIMER0_CONFIG_MAX_TCY        \
+((TIMER0_CONFIG_TCY_PER_MS*TIMER0_CONFIG_MAX_PERIOD_US+999UL)/1000UL)
+#define TIMER0_CONFIG_PRESCALE       TIMER0_PRESCALE_OF(TIMER0_CONFIG_PERIOD_TCY)
+#define TIMER0_CONFIG_PS_BITS        TIMER0_PS_BITS_OF(TIMER0_CONFIG_PRESCALE)
+#define TIMER0_CONFIG_EXTEND_PRESCALE TIMER0_PRESCALE_OF(TIMER0_CONFIG_MAX_TCY)
+#if TIMER0_CONFIG_MAX_PERIOD_US < TIMER0_CONFIG_PERIOD_US
+#error "TIMER0_CONFIG_MAX_PERIOD_US can't be shorter than the period"
+#elif TIMER0_CONFIG_PRESCALE == 0
+#error "TIMER0_CONFIG_PERIOD_US is too long for Timer0 at 1:256"
+#elif TIMER0_CONFIG_EXTEND_PRESCALE == 0
+#error "TIMER0_CONFIG_MAX_PERIOD_US is too long for Timer0 at 1:256"
+#elif (TIMER0_CONFIG_PERIOD_TCY % TIMER0_CONFIG_PRESCALE) != 0
+#error "TIMER0_CONFIG_PERIOD_US isn't whole counts after the prescaler"
+#endif
+#define TIMER0_CONFIG_PERIOD_COUNTS  (TIMER0_CONFIG_PERIOD_TCY/TIMER0_CONFIG_PRESCALE)
+#define TIMER0_CONFIG_RELOAD         (0x10000UL-TIMER0_CONFIG_PERIOD_COUNTS)
+/* Stopped, 16 bits, internal clock (Tcy) and the prescaler */
+#define TIMER0_CONFIG_T0CON          TIMER0_CONFIG_PS_BITS
+#define TIMER0_CONFIG_EXTEND_T0CON   TIMER0_PS_BITS_OF(TIMER0_CONFIG_EXTEND_PRESCALE)
 
 /* User-defined data types */
 /*****************************************************************************/
@@ -113,6 +170,16 @@ typedef struct {
   */
 Std_ErrorType HAL_Timer0_init(HAL_Timer0_ConfigType * Timer0_Config);
 
+/**
+  * @brief	By a call to HAL_Timer0_initStatic Timer0 will be initialized with
+  *			the compile-time configuration of Timer0_Config.h, three constant
+  *			register writes and no checks (the build did them).
+  *	@note	Calling this function doesn't start timer0 it just configures it.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer0_initStatic(void);
+
 /**
   * @brief	By a call to HAL_Timer0_start Timer0 will start. 
   *	@param	None.
@@ -138,6 +205,59 @@ void HAL_Timer0_stop(void);
   */
 Std_ErrorType HAL_Timer0_updateConfig(HAL_Timer0_ConfigType * Timer0_Config);
 
+/**
+  * @brief	By a call to HAL_Timer0_reload The Timer0_Data of the last init
+  *			is added to the running count, so the counts since the overflow
+  *			(interrupt latency) are kept and the next overflow is one period
+  *			after the last one. Call it from the Timer0 interrupt only.
+  *	@note	Drift free with TIMER0_PRESCALER_OFF, writing TMR0 clears the
+  *			prescaler and its counts are lost.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer0_reload(void);
+
+/**
+  * @brief	By a call to HAL_Timer0_extend The period which runs now ends
+  *			Timer0_Cycles Tcy later, counted on the prescaler of
+  *			TIMER0_CONFIG_MAX_PERIOD_US. HAL_Timer0_reload goes back to the
+  *			period's prescaler, the next periods are not changed. Used by a
+  *			tickless idle to sleep several ticks in one period.
+  *	@note	Call it with interrupts disabled before the overflow (TMR0IF
+  *			clear), after HAL_Timer0_initStatic. The stretched period is
+  *			within TIMER0_CONFIG_EXTEND_PRESCALE Tcy, the prescaler can't be
+  *			read; the ticks which follow are exact again.
+  *	@param	Timer0_Cycles Tcy added to the running period.
+  *	@return	None.
+  */
+void HAL_Timer0_extend(uint32 Timer0_Cycles);
+
+/**
+  * @brief	By a call to HAL_Timer0_getPrescale The prescaler Timer0 counts
+  *			on now is returned, the one of the stretched period till the
+  *			reload which ends it.
+  *	@param	None.
+  *	@return	Tcy per count.
+  */
+uint16 HAL_Timer0_getPrescale(void);
+
+/**
+  * @brief	By a call to HAL_Timer0_read The running count is returned, the
+  *			TMR0L read latches TMR0H so both bytes are of the same count.
+  *	@param	None.
+  *	@return	TMR0H:TMR0L (TMR0L only in 8 bits).
+  */
+uint16 HAL_Timer0_read(void);
+
+/**
+  * @brief	By a call to HAL_Timer0_write The count is loaded, TMR0H is
+  *			buffered till the TMR0L write.
+  *	@note	The write clears the prescaler and inhibits 2 Tcy of counting.
+  *	@param	Timer0_Count The new count.
+  *	@return	None.
+  */
+void HAL_Timer0_write(uint16 Timer0_Count);
+
  
  
 
@@ -0,0 +1,153 @@
+/*****************************************************************************/
+/** File:    HAL_Timer1.h                                                   **/
+/**                                                                         **/
+/** Description: This file define all needed APIs, data-types and files     **/
+/**              needed for Timer1 Driver.                                  **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _HAL_TIMER1_H_
+#define _HAL_TIMER1_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+#include "HAL_RegisterAccess.h"
+
+/* Macros */
+#define TIMER1L_Reg 0x0FCE /* Timer1L Register base address */
+#define TIMER1H_Reg 0x0FCF /* Timer1H Register base address */
+/* Frequency of the watch crystal on T1OSO/T1OSI */
+#define TIMER1_OSCILLATOR_HZ 32768UL
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is to indicate the mode of Timer1.                    **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: - TIMER1_TIMER       => 0x00 -> Timer1 increments with the      **/
+/**                                         internal clock (Fosc/4).        **/
+/**         - TIMER1_COUNTER     => 0x01 -> Timer1 increments with rising   **/
+/**                                         edges on T13CKI, synchronized   **/
+/**                                         (stops in sleep).               **/
+/**         - TIMER1_OSCILLATOR  => 0x02 -> Timer1 increments with its own  **/
+/**                                         crystal oscillator on T1OSO/    **/
+/**                                         T1OSI, not synchronized, it     **/
+/**                                         counts and wakes up in sleep.   **/
+/*****************************************************************************/
+typedef enum {
+      TIMER1_TIMER       =0x00,
+      TIMER1_COUNTER     =0x01,
+      TIMER1_OSCILLATOR  =0x02
+} HAL_Timer1_ModeType;
+
+/*****************************************************************************/
+/** Description: This is to indicate the prescaler.                         **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: -   TIMER1_PRESCALER_OFF   =>        0x00                       **/
+/**         -   TIMER1_PRESCALER_2     =>        0x01                       **/
+/**         -   TIMER1_PRESCALER_4     =>        0x02                       **/
+/**         -   TIMER1_PRESCALER_8     =>        0x03                       **/
+/*****************************************************************************/
+typedef enum {
+      TIMER1_PRESCALER_OFF   =0x00,
+      TIMER1_PRESCALER_2     =0x01,
+      TIMER1_PRESCALER_4     =0x02,
+      TIMER1_PRESCALER_8     =0x03
+} HAL_Timer1_PrescalerType;
+
+/*****************************************************************************/
+/** Description: This is to define all needed configurations for Timer1.    **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - Timer1_Mode         => The mode of the timer.               **/
+/**           - Timer1_Prescaler    => Prescaler value.                     **/
+/**           - Timer1_Data         => Data to be written in timer register **/
+/**                                    and added at every overflow by       **/
+/**                                    HAL_Timer1_reload, its low byte must **/
+/**                                    be 0 with TIMER1_OSCILLATOR.         **/
+/*****************************************************************************/
+typedef struct {
+        HAL_Timer1_ModeType      Timer1_Mode;
+        HAL_Timer1_PrescalerType Timer1_Prescaler;
+        uint16                   Timer1_Data;
+}HAL_Timer1_ConfigType;
+
+/* Function Prototype */
+/**
+  * @brief	By a call to HAL_Timer1_init Timer1 will be initialized with
+  *			configurations filled in passed pointer to struct.
+  *	@note	Calling this function doesn't start timer1 it just configures it.
+  *			With TIMER1_OSCILLATOR the oscillator is enabled here and stays
+  *			on, give the crystal its start-up time before relying on it.
+  *	@param	Timer1_Config Pointer to HAL_Timer1_ConfigType which is filled
+  *			with needed configurations defined in HAL_Timer1_ConfigType
+  *			structure.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType HAL_Timer1_init(HAL_Timer1_ConfigType * Timer1_Config);
+
+/**
+  * @brief	By a call to HAL_Timer1_start Timer1 will start.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer1_start(void);
+
+/**
+  * @brief	By a call to HAL_Timer1_stop Timer1 will stop, the oscillator
+  *			keeps running.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer1_stop(void);
+
+/**
+  * @brief	By a call to HAL_Timer1_updateConfig Timer1 configurations will
+  *			be updated with configurations filled in passed pointer to struct.
+  *	@note	Calling this function initialize and start timer1, the first
+  *			period is a full one.
+  *	@param	Timer1_Config Pointer to HAL_Timer1_ConfigType which is filled
+  *			with needed configurations defined in HAL_Timer1_ConfigType
+  *			structure.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType HAL_Timer1_updateConfig(HAL_Timer1_ConfigType * Timer1_Config);
+
+/**
+  * @brief	By a call to HAL_Timer1_reload The Timer1_Data of the last init
+  *			is added to the running count, the counts since the overflow are
+  *			kept. Call it from the Timer1 interrupt only.
+  *	@note	A reload with low byte 0 sets its bits in TMR1H by one read-
+  *			modify-write: TMR1L is not touched, which is the only exact and
+  *			safe write while the oscillator counts asynchronously. TMR1H
+  *			must still be below the lowest reload bit (500 ms for 0xC000).
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer1_reload(void);
+
+/**
+  * @brief	By a call to HAL_Timer1_read The running count is returned, TMR1H
+  *			is read again and the read repeated if TMR1L carried in between.
+  *	@param	None.
+  *	@return	TMR1H:TMR1L.
+  */
+uint16 HAL_Timer1_read(void);
+
+/**
+  * @brief	By a call to HAL_Timer1_write The count is loaded, TMR1H first.
+  *	@note	Not while it counts with TIMER1_OSCILLATOR (asynchronous), the
+  *			write may be missed or the count corrupted, stop it first.
+  *	@param	Timer1_Count The new count.
+  *	@return	None.
+  */
+void HAL_Timer1_write(uint16 Timer1_Count);
+
+#endif /* _HAL_TIMER1_H_ */
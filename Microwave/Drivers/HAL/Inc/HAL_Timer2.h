@@ -0,0 +1,109 @@
+/*****************************************************************************/
+/** File:    HAL_Timer2.h                                                   **/
+/**                                                                         **/
+/** Description: This file define all needed APIs, data-types and files     **/
+/**              needed for Timer2 Driver.                                  **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _HAL_TIMER2_H_
+#define _HAL_TIMER2_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+#include "HAL_RegisterAccess.h"
+
+/* Macros */
+#define TIMER2_Reg 0x0FCC /* Timer2 Register base address */
+#define PR2_Reg    0x0FCB /* Timer2 period Register base address */
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is to indicate the prescaler.                         **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: -   TIMER2_PRESCALER_OFF   =>        0x00                       **/
+/**         -   TIMER2_PRESCALER_4     =>        0x01                       **/
+/**         -   TIMER2_PRESCALER_16    =>        0x02                       **/
+/*****************************************************************************/
+typedef enum {
+      TIMER2_PRESCALER_OFF   =0x00,
+      TIMER2_PRESCALER_4     =0x01,
+      TIMER2_PRESCALER_16    =0x02
+} HAL_Timer2_PrescalerType;
+
+/*****************************************************************************/
+/** Description: This is to define all needed configurations for Timer2.    **/
+/**              TMR2 counts Tcy/prescaler from 0 to Timer2_Period, every   **/
+/**              Timer2_Postscaler matches set TMR2IF.                      **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - Timer2_Prescaler    => Prescaler value.                     **/
+/**           - Timer2_Postscaler   => Matches per interrupt, 1..16.        **/
+/**           - Timer2_Period       => Data to be written in PR2, the       **/
+/**                                    period is Timer2_Period+1 counts.    **/
+/*****************************************************************************/
+typedef struct {
+        HAL_Timer2_PrescalerType Timer2_Prescaler;
+        uint8                    Timer2_Postscaler;
+        uint8                    Timer2_Period;
+}HAL_Timer2_ConfigType;
+
+/* Function Prototype */
+/**
+  * @brief	By a call to HAL_Timer2_init Timer2 will be initialized with
+  *			configurations filled in passed pointer to struct, TMR2 is 0.
+  *	@note	Calling this function doesn't start timer2 it just configures it.
+  *	@param	Timer2_Config Pointer to HAL_Timer2_ConfigType which is filled
+  *			with needed configurations defined in HAL_Timer2_ConfigType
+  *			structure.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType HAL_Timer2_init(HAL_Timer2_ConfigType * Timer2_Config);
+
+/**
+  * @brief	By a call to HAL_Timer2_start Timer2 will start.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer2_start(void);
+
+/**
+  * @brief	By a call to HAL_Timer2_stop Timer2 will stop.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer2_stop(void);
+
+/**
+  * @brief	By a call to HAL_Timer2_updateConfig Timer2 configurations will
+  *			be updated with configurations filled in passed pointer to struct.
+  *	@note	Calling this function initialize and start timer2.
+  *	@param	Timer2_Config Pointer to HAL_Timer2_ConfigType which is filled
+  *			with needed configurations defined in HAL_Timer2_ConfigType
+  *			structure.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType HAL_Timer2_updateConfig(HAL_Timer2_ConfigType * Timer2_Config);
+
+/**
+  * @brief	By a call to HAL_Timer2_read The count of TMR2 is returned.
+  *	@param	None.
+  *	@return	TMR2.
+  */
+uint8 HAL_Timer2_read(void);
+
+/**
+  * @brief	By a call to HAL_Timer2_write TMR2 is loaded.
+  *	@note	The write clears the prescaler and the postscaler.
+  *	@param	Timer2_Count New count, below Timer2_Period to keep the period.
+  *	@return	None.
+  */
+void HAL_Timer2_write(uint8 Timer2_Count);
+
+#endif /* _HAL_TIMER2_H_ */
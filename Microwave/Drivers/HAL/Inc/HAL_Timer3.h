@@ -0,0 +1,155 @@
+/*****************************************************************************/
+/** File:    HAL_Timer3.h                                                   **/
+/**                                                                         **/
+/** Description: This file define all needed APIs, data-types and files     **/
+/**              needed for Timer3 Driver.                                  **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _HAL_TIMER3_H_
+#define _HAL_TIMER3_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+#include "HAL_RegisterAccess.h"
+
+/* Macros */
+#define TIMER3L_Reg 0x0FB2 /* Timer3L Register base address */
+#define TIMER3H_Reg 0x0FB3 /* Timer3H Register base address */
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is to indicate the mode of Timer3.                    **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: - TIMER3_TIMER       => 0x00 -> Timer3 increments with the      **/
+/**                                         internal clock (Fosc/4), 16     **/
+/**                                         bits read/write (RD16).         **/
+/**         - TIMER3_COUNTER     => 0x01 -> Timer3 increments with rising   **/
+/**                                         edges on T13CKI, synchronized   **/
+/**                                         (stops in sleep).               **/
+/**         - TIMER3_OSCILLATOR  => 0x02 -> Timer3 increments with the      **/
+/**                                         Timer1 oscillator (enabled by   **/
+/**                                         HAL_Timer1_init), not           **/
+/**                                         synchronized, it counts and     **/
+/**                                         wakes up in sleep.              **/
+/*****************************************************************************/
+typedef enum {
+      TIMER3_TIMER       =0x00,
+      TIMER3_COUNTER     =0x01,
+      TIMER3_OSCILLATOR  =0x02
+} HAL_Timer3_ModeType;
+
+/*****************************************************************************/
+/** Description: This is to indicate the prescaler.                         **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: -   TIMER3_PRESCALER_OFF   =>        0x00                       **/
+/**         -   TIMER3_PRESCALER_2     =>        0x01                       **/
+/**         -   TIMER3_PRESCALER_4     =>        0x02                       **/
+/**         -   TIMER3_PRESCALER_8     =>        0x03                       **/
+/*****************************************************************************/
+typedef enum {
+      TIMER3_PRESCALER_OFF   =0x00,
+      TIMER3_PRESCALER_2     =0x01,
+      TIMER3_PRESCALER_4     =0x02,
+      TIMER3_PRESCALER_8     =0x03
+} HAL_Timer3_PrescalerType;
+
+/*****************************************************************************/
+/** Description: This is to define all needed configurations for Timer3.    **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - Timer3_Mode         => The mode of the timer.               **/
+/**           - Timer3_Prescaler    => Prescaler value.                     **/
+/**           - Timer3_Data         => Data to be written in timer register **/
+/**                                    and added at every overflow by       **/
+/**                                    HAL_Timer3_reload, its low byte must **/
+/**                                    be 0 with TIMER3_OSCILLATOR.         **/
+/*****************************************************************************/
+typedef struct {
+        HAL_Timer3_ModeType      Timer3_Mode;
+        HAL_Timer3_PrescalerType Timer3_Prescaler;
+        uint16                   Timer3_Data;
+}HAL_Timer3_ConfigType;
+
+/* Function Prototype */
+/**
+  * @brief	By a call to HAL_Timer3_init Timer3 will be initialized with
+  *			configurations filled in passed pointer to struct.
+  *	@note	Calling this function doesn't start timer3 it just configures it.
+  *			TIMER3_OSCILLATOR counts the Timer1 oscillator, HAL_Timer1_init
+  *			with TIMER1_OSCILLATOR enables it. CCP1/CCP2 keep Timer1.
+  *			TIMER3_TIMER sets RD16: reading TMR3L latches TMR3H, so TMR3L
+  *			then TMR3H (TIMER3L_Reg, TIMER3H_Reg) is one 16 bits count.
+  *	@param	Timer3_Config Pointer to HAL_Timer3_ConfigType which is filled
+  *			with needed configurations defined in HAL_Timer3_ConfigType
+  *			structure.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType HAL_Timer3_init(HAL_Timer3_ConfigType * Timer3_Config);
+
+/**
+  * @brief	By a call to HAL_Timer3_start Timer3 will start.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer3_start(void);
+
+/**
+  * @brief	By a call to HAL_Timer3_stop Timer3 will stop.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer3_stop(void);
+
+/**
+  * @brief	By a call to HAL_Timer3_updateConfig Timer3 configurations will
+  *			be updated with configurations filled in passed pointer to struct.
+  *	@note	Calling this function initialize and start timer3, the first
+  *			period is a full one.
+  *	@param	Timer3_Config Pointer to HAL_Timer3_ConfigType which is filled
+  *			with needed configurations defined in HAL_Timer3_ConfigType
+  *			structure.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType HAL_Timer3_updateConfig(HAL_Timer3_ConfigType * Timer3_Config);
+
+/**
+  * @brief	By a call to HAL_Timer3_reload The Timer3_Data of the last init
+  *			is added to the running count, the counts since the overflow are
+  *			kept. Call it from the Timer3 interrupt only.
+  *	@note	Without RD16, a reload with low byte 0 sets its bits in TMR3H by
+  *			one read-modify-write: TMR3L is not touched, which is the only
+  *			exact and safe write while the oscillator counts asynchronously.
+  *			TMR3H must still be below the lowest reload bit.
+  *	@param	None.
+  *	@return	None.
+  */
+void HAL_Timer3_reload(void);
+
+/**
+  * @brief	By a call to HAL_Timer3_read The running count is returned, TMR3L
+  *			then the latched TMR3H with RD16. Else TMR3H is read again and
+  *			the read repeated if TMR3L carried in between.
+  *	@param	None.
+  *	@return	TMR3H:TMR3L.
+  */
+uint16 HAL_Timer3_read(void);
+
+/**
+  * @brief	By a call to HAL_Timer3_write The count is loaded, TMR3H first.
+  *	@note	Not while it counts with TIMER3_OSCILLATOR (asynchronous), the
+  *			write may be missed or the count corrupted, stop it first.
+  *	@param	Timer3_Count The new count.
+  *	@return	None.
+  */
+void HAL_Timer3_write(uint16 Timer3_Count);
+
+#endif /* _HAL_TIMER3_H_ */
@@ -13,13 +13,13 @@
 
 
 /* Local Macros */
-#define PORT_DIRECTION_OFFSET 0x12  /* The difference of the addressees 
-                                       between PORTx and TRISx */
-#define PORT_LATCH_OFFSET 0x09      /* The difference of the addressees
-                                       between PORTx and LATx */
 #define ADCON1_ADDRESS 0x0FC1      /* ADCON1 address needed to disable
                                       analog function for portB */
 
+/* Global variables */
+uint8 GPIO_LatchShadow[GPIO_NUMBER_OF_PORTS];   /* RAM copy of LATx */
+uint8 GPIO_PortSnapshot[GPIO_NUMBER_OF_PORTS];  /* PORTx of the last snapshot */
+
 /* Private functions prototype */
 static Std_ErrorType GPIO_CheckError(HAL_GPIO_DeviceType * GPIO_Device);
 
@@ -88,11 +88,22 @@ Std_ErrorType GPIO_DeviceInit(HAL_GPIO_DeviceType * GPIO_Device)
                            channels */
                 }
       }
+      /* A shadowed port takes its latch first, so the shadowed write of
+         the pin keeps the other pins of the port */
+      if(GPIO_PORT_SHADOWED(GPIO_Device->devicePortBaseAddress))
+      {
+            GPIO_LATCH_SHADOW(GPIO_Device->devicePortBaseAddress)=
+            HAL_RegisterRead((GPIO_Device->devicePortBaseAddress)+PORT_LATCH_OFFSET);
+      }
+      /* Set the latch of an output pin to initial state before driving
+         it, the other pins of the port are not affected */
+      if(GPIO_Device->deviceDirection==OUTPUT)
+      {
+            GPIO_PIN_ASSIGN_(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin,
+                             GPIO_OUTPUT_INITIAL_STATE);
+      }
       HAL_RegisterWrite((GPIO_Device->devicePortBaseAddress)+PORT_DIRECTION_OFFSET,_Temp);
       
-      /* Set the pin to initial state */
-      HAL_RegisterWrite(GPIO_Device->devicePortBaseAddress,GPIO_OUTPUT_INITIAL_STATE);
-      
       return STD_OK;  /* No Error */
 }
 
@@ -117,8 +128,8 @@ Std_ErrorType GPIO_DeviceSet(HAL_GPIO_DeviceType * GPIO_Device)
       _Temp= GPIO_CheckError(GPIO_Device);  /* Error check */
       if(STD_ERROR==_Temp)      return STD_ERROR;   /* Error in struct */
 
-       /* Set the pin of the device (HIGH) */
-      HAL_RegisterSetBit(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
+       /* Set the latch of the device (HIGH) */
+      GPIO_PIN_SET_(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
 
       return STD_OK;  /* No Error */
 }
@@ -144,8 +155,8 @@ Std_ErrorType GPIO_DeviceClear(HAL_GPIO_DeviceType * GPIO_Device)
       _Temp= GPIO_CheckError(GPIO_Device);  /* Error check */
       if(STD_ERROR==_Temp)      return STD_ERROR;   /* Error in struct */
 
-       /* Clear the pin of the device (LOW) */
-      HAL_RegisterClearBit(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
+       /* Clear the latch of the device (LOW) */
+      GPIO_PIN_CLEAR_(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
 
       return STD_OK;  /* No Error */
 }
@@ -172,16 +183,8 @@ Std_ErrorType GPIO_DeviceToggle(HAL_GPIO_DeviceType * GPIO_Device)
       _Temp= GPIO_CheckError(GPIO_Device);  /* Error check */
       if(STD_ERROR==_Temp)      return STD_ERROR;   /* Error in struct */
 
-      /* Get the status and toggle it */
-      _Temp  = HAL_RegisterRead(GPIO_Device->devicePortBaseAddress);
-      if(_Temp & (1<<(GPIO_Device->devicePin)))
-      {     
-            HAL_RegisterClearBit(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
-      }
-      else
-      {
-            HAL_RegisterSetBit(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
-      }
+      /* Toggle the latch, the pin level is not read back */
+      GPIO_PIN_TOGGLE_(GPIO_Device->devicePortBaseAddress,GPIO_Device->devicePin);
       
       return STD_OK;  /* No Error */
 }
@@ -262,4 +265,260 @@ Std_ErrorType GPIO_DeviceGetRead(HAL_GPIO_DeviceType * GPIO_Device,
       else                                          *(ReturnStatus) = LOW;
 
       return STD_OK;  /* No Error */
-}
\ No newline at end of file
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_DeviceInitHandle The passed GPIO device  **/
+/**              will be initialized by GPIO_DeviceInit (all checks are     **/
+/**              done here once) and the passed handle filled with the pin  **/
+/**              mask and the PORTx, LATx and TRISx addresses.              **/
+/**                                                                         **/
+/** Parameters: + GPIO_Device => Pointer to HAL_GPIO_DeviceType which is    **/
+/**                              filled with needed configurations defined  **/
+/**                              HAL_GPIO_DeviceType structure.             **/
+/**             + GPIO_Handle => Pointer to HAL_GPIO_HandleType to be       **/
+/**                              filled.                                    **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When all configurations filled    **/
+/**                                       with correct data.                **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer,    **/
+/**                                       the handle must not be used.      **/
+/*****************************************************************************/
+Std_ErrorType GPIO_DeviceInitHandle(HAL_GPIO_DeviceType * GPIO_Device,
+                                    HAL_GPIO_HandleType * GPIO_Handle)
+{
+      uint8 _Temp;  /* temp variable */
+
+      if(GPIO_Handle == (HAL_GPIO_HandleType *)NULL_PTR) /* Passing NULL pointer */
+      return STD_ERROR;
+
+      _Temp= GPIO_DeviceInit(GPIO_Device);  /* Error check and init */
+      if(STD_ERROR==_Temp)      return STD_ERROR;   /* Error in struct */
+
+      GPIO_Handle->portAddress      = GPIO_Device->devicePortBaseAddress;
+      GPIO_Handle->latchAddress     = GPIO_Device->devicePortBaseAddress+PORT_LATCH_OFFSET;
+      GPIO_Handle->directionAddress = GPIO_Device->devicePortBaseAddress+PORT_DIRECTION_OFFSET;
+      GPIO_Handle->pinMask          = (1<<(GPIO_Device->devicePin));
+      if(GPIO_PORT_SHADOWED(GPIO_Device->devicePortBaseAddress))
+            GPIO_Handle->latchShadow = &GPIO_LATCH_SHADOW(GPIO_Device->devicePortBaseAddress);
+      else
+            GPIO_Handle->latchShadow = (uint8 *)NULL_PTR;
+
+      return STD_OK;  /* No Error */
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_HandleSet The pin of the passed handle   **/
+/**              will be set (HIGH), there is no check.                     **/
+/**                                                                         **/
+/** Parameters: + GPIO_Handle => Pointer to HAL_GPIO_HandleType which is    **/
+/**                              filled by GPIO_DeviceInitHandle.           **/
+/*****************************************************************************/
+void GPIO_HandleSet(const HAL_GPIO_HandleType * GPIO_Handle)
+{
+      if(GPIO_Handle->latchShadow != (uint8 *)NULL_PTR)
+      {
+            *(GPIO_Handle->latchShadow) |= GPIO_Handle->pinMask;
+            HAL_RegisterWrite(GPIO_Handle->latchAddress,*(GPIO_Handle->latchShadow));
+      }
+      else
+      {
+            HAL_RegisterSetMask(GPIO_Handle->latchAddress,GPIO_Handle->pinMask);
+      }
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_HandleClear The pin of the passed handle **/
+/**              will be cleared (LOW), there is no check.                  **/
+/**                                                                         **/
+/** Parameters: + GPIO_Handle => Pointer to HAL_GPIO_HandleType which is    **/
+/**                              filled by GPIO_DeviceInitHandle.           **/
+/*****************************************************************************/
+void GPIO_HandleClear(const HAL_GPIO_HandleType * GPIO_Handle)
+{
+      if(GPIO_Handle->latchShadow != (uint8 *)NULL_PTR)
+      {
+            *(GPIO_Handle->latchShadow) &=~ GPIO_Handle->pinMask;
+            HAL_RegisterWrite(GPIO_Handle->latchAddress,*(GPIO_Handle->latchShadow));
+      }
+      else
+      {
+            HAL_RegisterClearMask(GPIO_Handle->latchAddress,GPIO_Handle->pinMask);
+      }
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_HandleToggle The latch of the passed     **/
+/**              handle pin will be inverted, there is no check.            **/
+/**                                                                         **/
+/** Parameters: + GPIO_Handle => Pointer to HAL_GPIO_HandleType which is    **/
+/**                              filled by GPIO_DeviceInitHandle.           **/
+/*****************************************************************************/
+void GPIO_HandleToggle(const HAL_GPIO_HandleType * GPIO_Handle)
+{
+      if(GPIO_Handle->latchShadow != (uint8 *)NULL_PTR)
+      {
+            *(GPIO_Handle->latchShadow) ^= GPIO_Handle->pinMask;
+            HAL_RegisterWrite(GPIO_Handle->latchAddress,*(GPIO_Handle->latchShadow));
+      }
+      else
+      {
+            HAL_RegisterToggleMask(GPIO_Handle->latchAddress,GPIO_Handle->pinMask);
+      }
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_HandleGetRead The pin of the passed      **/
+/**              handle will be read, there is no check.                    **/
+/**                                                                         **/
+/** Parameters: + GPIO_Handle => Pointer to HAL_GPIO_HandleType which is    **/
+/**                              filled by GPIO_DeviceInitHandle.           **/
+/**                                                                         **/
+/** Return: HAL_GPIO_StatusType => HIGH or LOW.                             **/
+/*****************************************************************************/
+HAL_GPIO_StatusType GPIO_HandleGetRead(const HAL_GPIO_HandleType * GPIO_Handle)
+{
+      if(HAL_RegisterRead(GPIO_Handle->portAddress) & GPIO_Handle->pinMask)   return HIGH;
+      return LOW;
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_HandleGetSnapshot The pin of the passed  **/
+/**              handle will be read from the last port snapshot.           **/
+/**                                                                         **/
+/** Parameters: + GPIO_Handle => Pointer to HAL_GPIO_HandleType which is    **/
+/**                              filled by GPIO_DeviceInitHandle.           **/
+/**                                                                         **/
+/** Return: HAL_GPIO_StatusType => HIGH or LOW.                             **/
+/*****************************************************************************/
+HAL_GPIO_StatusType GPIO_HandleGetSnapshot(const HAL_GPIO_HandleType * GPIO_Handle)
+{
+      if(GPIO_PortSnapshot[GPIO_PORT_INDEX(GPIO_Handle->portAddress)] & GPIO_Handle->pinMask)
+      return HIGH;
+      return LOW;
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_SnapshotTake Every port in the passed    **/
+/**              mask will be read once and kept in GPIO_PortSnapshot, so   **/
+/**              all queries of one pass see the same inputs.               **/
+/**                                                                         **/
+/** Parameters: + PortsMask => GPIO_PORT_MASK of the ports to be latched.   **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the ports are latched.       **/
+/**                           - E_NOT_OK: If the mask has no port or a      **/
+/**                                       wrong port.                       **/
+/*****************************************************************************/
+Std_ErrorType GPIO_SnapshotTake(uint8 PortsMask)
+{
+      uint8 _Port;  /* Index of port */
+
+      if(PortsMask == 0 || (PortsMask & ~GPIO_ALL_PORTS_MASK))
+      return STD_ERROR;   /* Wrong ports */
+
+      for(_Port=0; _Port<GPIO_NUMBER_OF_PORTS; _Port++)
+      {
+            if(PortsMask & (1<<_Port))
+            {
+                  GPIO_PortSnapshot[_Port]=HAL_RegisterRead(PORTA_BASE_ADDRESS+_Port);
+            }
+      }
+
+      return STD_OK;  /* No Error */
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_GroupInit The passed output devices      **/
+/**              will be checked once and their pins collected in one mask  **/
+/**              per port, so the group is switched by one write per port.  **/
+/**                                                                         **/
+/** Parameters: + GPIO_Group => Pointer to HAL_GPIO_GroupType to be filled. **/
+/**             + GPIO_Devices => Array of pointers to output devices which **/
+/**                               are initialized by GPIO_DeviceInit.       **/
+/**             + DevicesNumber => Number of devices in GPIO_Devices.       **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When all devices are correct      **/
+/**                                       outputs.                          **/
+/**                           - E_NOT_OK: If there is a wrong device, an    **/
+/**                                       input device or NULL pointer.     **/
+/*****************************************************************************/
+Std_ErrorType GPIO_GroupInit(HAL_GPIO_GroupType * GPIO_Group,
+                             HAL_GPIO_DeviceType * const * GPIO_Devices,
+                             uint8 DevicesNumber)
+{
+      uint8 _Temp;       /* temp variable */
+      uint8 _Device;     /* Index of device */
+      uint8 _Port;       /* Index of port in the group */
+
+      if(GPIO_Group == (HAL_GPIO_GroupType *)NULL_PTR ||
+         GPIO_Devices == (HAL_GPIO_DeviceType * const *)NULL_PTR) /* Passing NULL pointer */
+      return STD_ERROR;
+
+      GPIO_Group->portsNumber=0;
+      for(_Device=0; _Device<DevicesNumber; _Device++)
+      {
+            _Temp= GPIO_CheckError(GPIO_Devices[_Device]);  /* Error check */
+            if(STD_ERROR==_Temp)      return STD_ERROR;   /* Error in struct */
+            if(GPIO_Devices[_Device]->deviceDirection != OUTPUT)
+            return STD_ERROR;   /* Only output devices can be switched */
+
+            /* Find the port of the device in the group or add it */
+            for(_Port=0; _Port<GPIO_Group->portsNumber; _Port++)
+            {
+                  if(GPIO_Group->ports[_Port].portBaseAddress ==
+                     GPIO_Devices[_Device]->devicePortBaseAddress)   break;
+            }
+            if(_Port == GPIO_Group->portsNumber)
+            {
+                  GPIO_Group->ports[_Port].portBaseAddress=GPIO_Devices[_Device]->devicePortBaseAddress;
+                  GPIO_Group->ports[_Port].pinsMask=0;
+                  GPIO_Group->portsNumber++;
+            }
+            GPIO_Group->ports[_Port].pinsMask |= (1<<(GPIO_Devices[_Device]->devicePin));
+      }
+
+      return STD_OK;  /* No Error */
+}
+
+/*****************************************************************************/
+/** Description: By a call to GPIO_GroupAssignStatus all devices of the     **/
+/**              passed group will be setted by GPIO_DeviceStatus, one      **/
+/**              masked LATx write per port (no per device check).          **/
+/**                                                                         **/
+/** Parameters: + GPIO_Group => Pointer to HAL_GPIO_GroupType which is      **/
+/**                             filled by GPIO_GroupInit.                   **/
+/**             + GPIO_DeviceStatus => The status needed to be assigned to  **/
+/**                                    devices pins (LOW or HIGH).          **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the group is switched.       **/
+/**                           - E_NOT_OK: If passed status is wrong or      **/
+/**                                       NULL pointer.                     **/
+/*****************************************************************************/
+Std_ErrorType GPIO_GroupAssignStatus(HAL_GPIO_GroupType * GPIO_Group,
+                                     HAL_GPIO_StatusType GPIO_DeviceStatus)
+{
+      uint8 _Temp;  /* temp variable */
+      uint8 _Port;  /* Index of port in the group */
+      uint16 _Address;  /* Base address of the port */
+
+      if(GPIO_Group == (HAL_GPIO_GroupType *)NULL_PTR) /* Passing NULL pointer */
+      return STD_ERROR;
+      if(GPIO_DeviceStatus != LOW && GPIO_DeviceStatus != HIGH)
+      return STD_ERROR;   /* Error in GPIO_DeviceStatus */
+
+      for(_Port=0; _Port<GPIO_Group->portsNumber; _Port++)
+      {
+            _Address=GPIO_Group->ports[_Port].portBaseAddress;
+            /* Start from the shadow or read back LATx, never PORTx */
+            if(GPIO_PORT_SHADOWED(_Address))  _Temp = GPIO_LATCH_SHADOW(_Address);
+            else                              _Temp = HAL_RegisterRead(_Address+PORT_LATCH_OFFSET);
+            if(GPIO_DeviceStatus==HIGH)   _Temp |=  (GPIO_Group->ports[_Port].pinsMask);
+            else                          _Temp &=~ (GPIO_Group->ports[_Port].pinsMask);
+            if(GPIO_PORT_SHADOWED(_Address))  GPIO_LATCH_SHADOW(_Address) = _Temp;
+            HAL_RegisterWrite(_Address+PORT_LATCH_OFFSET,_Temp);
+      }
+
+      return STD_OK;  /* No Error */
+}
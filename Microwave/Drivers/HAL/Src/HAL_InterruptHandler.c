@@ -18,11 +18,16 @@
 /* Private Macroos */
 
 #define INTCON_ADDRESS    0x0FF2
+#define INTCON2_ADDRESS   0x0FF1
 #define INTCON3_ADDRESS   0x0FF0
+#define PORTB_ADDRESS     0x0F81
 #define PIR1_ADDRESS      0x0F9E
 #define PIR2_ADDRESS      0x0FA1
 #define PIE1_ADDRESS      0x0F9D
 #define PIE2_ADDRESS      0x0FA0
+#define IPR1_ADDRESS      0x0F9F
+#define IPR2_ADDRESS      0x0FA2
+#define RCON_ADDRESS      0x0FD0
 
 #ifndef RBIF
 #define RBIF BIT_0
@@ -82,14 +87,137 @@
 #define CMIF BIT_6
 #endif  /* CMIF */
 #ifndef OSCFIF
-#define OSCFIF BIT_6
+#define OSCFIF BIT_7
 #endif  /* OSCFIF */
+#ifndef IPEN
+#define IPEN BIT_7
+#endif  /* IPEN */
+#ifndef TMR0IP
+#define TMR0IP BIT_2
+#endif  /* TMR0IP */
+#ifndef RBIP
+#define RBIP BIT_0
+#endif  /* RBIP */
+#ifndef INT1IP
+#define INT1IP BIT_6
+#endif  /* INT1IP */
+#ifndef INT2IP
+#define INT2IP BIT_7
+#endif  /* INT2IP */
+#ifndef INTEDG0
+#define INTEDG0 BIT_6
+#endif  /* INTEDG0 */
+#ifndef INTEDG1
+#define INTEDG1 BIT_5
+#endif  /* INTEDG1 */
+#ifndef INTEDG2
+#define INTEDG2 BIT_4
+#endif  /* INTEDG2 */
+
+#define INTERRUPT_NONE    0xFF   /* No source behind the flag bit */
+#define INTERRUPT_INTCON  0        /* Rows of InterruptHandler_Sources */
+#define INTERRUPT_INTCON3 1
+#define INTERRUPT_PIR1    2
+#define INTERRUPT_PIR2    3
+
+/* Clears flag BIT of a flag register with a constant address and bit: */
+/* one BCF, the high vector and the hardware setting another flag of   */
+/* the register in between can't be overwritten by a stale copy.       */
+#define INTERRUPT_CLEAR_FLAG(ADDRESS,BIT)  do{                                  \
+      switch(BIT)                                                               \
+      {                                                                         \
+            case 0:  HAL_RegisterClearBit(ADDRESS,BIT_0);  break;               \
+            case 1:  HAL_RegisterClearBit(ADDRESS,BIT_1);  break;               \
+            case 2:  HAL_RegisterClearBit(ADDRESS,BIT_2);  break;               \
+            case 3:  HAL_RegisterClearBit(ADDRESS,BIT_3);  break;               \
+            case 4:  HAL_RegisterClearBit(ADDRESS,BIT_4);  break;               \
+            case 5:  HAL_RegisterClearBit(ADDRESS,BIT_5);  break;               \
+            case 6:  HAL_RegisterClearBit(ADDRESS,BIT_6);  break;               \
+            default: HAL_RegisterClearBit(ADDRESS,BIT_7);  break;               \
+      }                                                                         \
+}while(0)
+
+/* Clears the flag and calls the callback of every bit of PENDING, lowest */
+/* first: one loop per pending source, the others aren't looked at. A     */
+/* macro so the high and the low vector, which can interrupt it, share no */
+/* function. ADDRESS is the flag register of ROW.                         */
+#define INTERRUPT_SERVICE(ROW,ADDRESS,PENDING)  do{                             \
+      uint8 _Pending=(PENDING);                                                 \
+      uint8 _Bit;                                                               \
+      uint8 _Source;                                                            \
+      while(_Pending)                                                           \
+      {                                                                         \
+            _Bit=InterruptHandler_LowestBit[_Pending & 0x0F];                   \
+            if((_Pending & 0x0F) == 0) _Bit=4+InterruptHandler_LowestBit[_Pending>>4]; \
+            _Pending &= _Pending-1;  /* Lowest bit done */                      \
+            _Source=InterruptHandler_Sources[ROW][_Bit];                        \
+            if(_Source == INT_RB) HAL_RegisterRead(PORTB_ADDRESS); /* Mismatch */ \
+            INTERRUPT_CLEAR_FLAG(ADDRESS,_Bit);                                 \
+            if(_Source != INTERRUPT_NONE                                        \
+               && InterruptHandler_Callbacks[_Source] != NULL_PTR)              \
+                  InterruptHandler_Callbacks[_Source]();                        \
+      }                                                                         \
+}while(0)
+
+/* Services the sources of one vector, MASK(ROW) are their flag bits. The */
+/* rows without any of them aren't read. The enables of INTCON and        */
+/* INTCON3 sit 3 bits above their flags.                                  */
+#define INTERRUPT_DISPATCH(MASK)  do{                                           \
+      uint8 _Reg;                                                               \
+      if(MASK(INTERRUPT_INTCON) & 0x07)                                         \
+      {                                                                         \
+            _Reg=HAL_RegisterRead(INTCON_ADDRESS);                              \
+            INTERRUPT_SERVICE(INTERRUPT_INTCON,INTCON_ADDRESS,                  \
+                              _Reg & (_Reg>>3) & MASK(INTERRUPT_INTCON) & 0x07); \
+      }                                                                         \
+      if(MASK(INTERRUPT_INTCON3) & 0x03)                                        \
+      {                                                                         \
+            _Reg=HAL_RegisterRead(INTCON3_ADDRESS);                             \
+            INTERRUPT_SERVICE(INTERRUPT_INTCON3,INTCON3_ADDRESS,                \
+                              _Reg & (_Reg>>3) & MASK(INTERRUPT_INTCON3) & 0x03); \
+      }                                                                         \
+      if(MASK(INTERRUPT_PIR1))                                                  \
+      {                                                                         \
+            _Reg=HAL_RegisterRead(PIR1_ADDRESS) & MASK(INTERRUPT_PIR1);         \
+            INTERRUPT_SERVICE(INTERRUPT_PIR1,PIR1_ADDRESS,                      \
+                              _Reg & HAL_RegisterRead(PIE1_ADDRESS));           \
+      }                                                                         \
+      if(MASK(INTERRUPT_PIR2))                                                  \
+      {                                                                         \
+            _Reg=HAL_RegisterRead(PIR2_ADDRESS) & MASK(INTERRUPT_PIR2);         \
+            INTERRUPT_SERVICE(INTERRUPT_PIR2,PIR2_ADDRESS,                      \
+                              _Reg & HAL_RegisterRead(PIE2_ADDRESS));           \
+      }                                                                         \
+}while(0)
+
+#define INTERRUPT_HIGH_MASK(ROW)  (InterruptHandler_HighMask[ROW])
+#define INTERRUPT_LOW_MASK(ROW)   ((uint8)~InterruptHandler_HighMask[ROW])
+
+/* Private constants */
+/* Priority register of each row and its bit above the flag bit: TMR0IP */
+/* and RBIP share the bits of their flags, INT1IP/INT2IP are 6 above.    */
+static const uint16 InterruptHandler_PriorityAddress[4]=
+       {INTCON2_ADDRESS,INTCON3_ADDRESS,IPR1_ADDRESS,IPR2_ADDRESS};
+static const uint8 InterruptHandler_PriorityShift[4]={0,6,0,0};
+/* Source of each flag bit, bit 0 first */
+static const uint8 InterruptHandler_Sources[4][8]=
+{
+       {INT_RB,INT_EXT0,INT_TMR0,INTERRUPT_NONE,
+        INTERRUPT_NONE,INTERRUPT_NONE,INTERRUPT_NONE,INTERRUPT_NONE},
+       {INT_EXT1,INT_EXT2,INTERRUPT_NONE,INTERRUPT_NONE,
+        INTERRUPT_NONE,INTERRUPT_NONE,INTERRUPT_NONE,INTERRUPT_NONE},
+       {INT_TMR1,INT_TMR2,INT_CCP1,INT_SSP,INT_TX,INT_RC,INT_AD,INT_PSP},
+       {INT_CCP2,INT_TMR3,INT_HLVD,INT_BCL,INT_EE,INTERRUPT_NONE,INT_CM,INT_OSCF}
+};
+/* Lowest set bit of a nibble */
+static const uint8 InterruptHandler_LowestBit[16]=
+       {0,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0};
 
 /* Private variables */
-#ifdef DRIVER_HANDLE_ISR
-static InterruptOcurrancyType * InterruptHandler_Flags[NUMBER_OF_ACTIVE_INTERRUPTS]=
-                 {0};
-#endif
+static InterruptCallbackType InterruptHandler_Callbacks[INTERRUPT_SOURCES_NUMBER];
+/* Flag bits of each row serviced by the high vector, all of them until */
+/* InterruptHandler_EnablePriority (IPEN clear: one vector)             */
+static uint8 InterruptHandler_HighMask[4]={0xFF,0xFF,0xFF,0xFF};
 
 /* Public functions defination */
 /*****************************************************************************/
@@ -99,27 +227,12 @@ static InterruptOcurrancyType * InterruptHandler_Flags[NUMBER_OF_ACTIVE_INTERRUP
 /** Parameters: + InterruptSource => Enum value defined as                  **/
 /**                                  InterruptSourceType to know which      **/
 /**                                  interrupt source you want to enable.   **/
-/**               [Optional if you defined DRIVER_HANDLE_ISR in             **/
-/**                HAL_InterruptHandler.h]                                  **/
-/**             + flagPointer => Pointer to flag with type of               **/
-/**                              InterruptOcurrancyType to set if the       **/
-/**                              interrupt happens "could be replaced with  **/
-/**                              pointer to function to call (call-back     **/
-/**                              function)".                                **/
 /**                                                                         **/
 /** Return: None.                                                           **/
 /*****************************************************************************/
-#ifdef DRIVER_HANDLE_ISR
-void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource,
-                                      InterruptOcurrancyType * flagPointer)
-#else
 void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource)
-#endif
 {
      InterruptHandler_EnbleGlobalInterrupt();
-#ifdef DRIVER_HANDLE_ISR
-         InterruptHandler_Flags[InterruptSource]=flagPointer;
-#endif
          switch(InterruptSource)
          {
                  case INT_EXT0:
@@ -150,7 +263,7 @@ void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource)
                       HAL_RegisterSetBit(PIE1_ADDRESS,CCP1IE);
                  break;                                                       
                  case INT_CCP2:
-                      HAL_RegisterSetBit(PIE1_ADDRESS,CCP2IE);
+                      HAL_RegisterSetBit(PIE2_ADDRESS,CCP2IE);
                  break;
                  case INT_TX:
                       HAL_RegisterSetBit(PIE1_ADDRESS,TXIE);
@@ -197,9 +310,6 @@ void InterruptHandler_EnableInterrupt(InterruptSourceType InterruptSource)
 /*****************************************************************************/
 void InterruptHandler_DisableInterrupt(InterruptSourceType InterruptSource)
 {
-#ifdef DRIVER_HANDLE_ISR
-     InterruptHandler_Flags[InterruptSource]=NULL;
-#endif
          switch(InterruptSource)
          {
                  case INT_EXT0:
@@ -230,7 +340,7 @@ void InterruptHandler_DisableInterrupt(InterruptSourceType InterruptSource)
                       HAL_RegisterClearBit(PIE1_ADDRESS,CCP1IE);
                  break;                                                       
                  case INT_CCP2:
-                      HAL_RegisterClearBit(PIE1_ADDRESS,CCP2IE);
+                      HAL_RegisterClearBit(PIE2_ADDRESS,CCP2IE);
                  break;
                  case INT_TX:
                       HAL_RegisterClearBit(PIE1_ADDRESS,TXIE);
@@ -265,6 +375,123 @@ void InterruptHandler_DisableInterrupt(InterruptSourceType InterruptSource)
          }
 }
 
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_ClearFlag it clears the flag **/
+/**              of specific interrupt source passed its identifier, so a   **/
+/**              stale flag doesn't fire once the source is enabled.        **/
+/**                                                                         **/
+/** Parameters: + InterruptSource => Enum value defined as                  **/
+/**                                  InterruptSourceType to know which      **/
+/**                                  interrupt flag you want to clear.      **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: PORTB is read before RBIF is cleared to end the mismatch.         **/
+/*****************************************************************************/
+void InterruptHandler_ClearFlag(InterruptSourceType InterruptSource)
+{
+         switch(InterruptSource)
+         {
+                 case INT_EXT0:
+                      HAL_RegisterClearBit(INTCON_ADDRESS,INT0IF);
+                 break;
+                 case INT_EXT1:
+                      HAL_RegisterClearBit(INTCON3_ADDRESS,INT1IF);
+                 break;
+                 case INT_EXT2:
+                      HAL_RegisterClearBit(INTCON3_ADDRESS,INT2IF);
+                 break;
+                 case INT_RB:
+                      HAL_RegisterRead(PORTB_ADDRESS);
+                      HAL_RegisterClearBit(INTCON_ADDRESS,RBIF);
+                 break;
+                 case INT_TMR0:
+                      HAL_RegisterClearBit(INTCON_ADDRESS,TMR0IF);
+                 break;
+                 case INT_TMR1:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,TMR1IF);
+                 break;
+                 case INT_TMR2:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,TMR2IF);
+                 break;
+                 case INT_TMR3:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,TMR3IF);
+                 break;
+                 case INT_CCP1:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,CCP1IF);
+                 break;
+                 case INT_CCP2:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,CCP2IF);
+                 break;
+                 case INT_TX:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,TXIF);
+                 break;
+                 case INT_RC:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,RCIF);
+                 break;
+                 case INT_SSP:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,SSPIF);
+                 break;
+                 case INT_AD:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,ADIF);
+                 break;
+                 case INT_PSP:
+                      HAL_RegisterClearBit(PIR1_ADDRESS,PSPIF);
+                 break;
+                 case INT_HLVD:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,HLVDIF);
+                 break;
+                 case INT_BCL:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,BCLIF);
+                 break;
+                 case INT_EE:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,EEIF);
+                 break;
+                 case INT_CM:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,CMIF);
+                 break;
+                 case INT_OSCF:
+                      HAL_RegisterClearBit(PIR2_ADDRESS,OSCFIF);
+                 break;
+         }
+}
+
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_SetEdge it selects the edge  **/
+/**              which sets the flag of an external interrupt (INT0..INT2). **/
+/**                                                                         **/
+/** Parameters: + InterruptSource => INT_EXT0, INT_EXT1 or INT_EXT2.        **/
+/**             + Edge => Enum value defined as InterruptEdgeType.          **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the edge is selected.        **/
+/**                           - E_NOT_OK: If the source isn't an external   **/
+/**                                       interrupt.                        **/
+/**                                                                         **/
+/** Note: Changing the edge may set the flag, clear it before enabling.     **/
+/*****************************************************************************/
+Std_ErrorType InterruptHandler_SetEdge(InterruptSourceType InterruptSource,
+                                       InterruptEdgeType Edge)
+{
+         uint8 _Bit;
+
+         switch(InterruptSource)
+         {
+                 case INT_EXT0:
+                      _Bit=INTEDG0;
+                 break;
+                 case INT_EXT1:
+                      _Bit=INTEDG1;
+                 break;
+                 case INT_EXT2:
+                      _Bit=INTEDG2;
+                 break;
+                 default:
+                      return STD_ERROR;  /* Not an external interrupt */
+         }
+         HAL_RegisterAssignBit(INTCON2_ADDRESS,_Bit,Edge);
+         return STD_OK;
+}
+
 /*****************************************************************************/
 /** Description: By a call to InterruptHandler_DisableGlobalInterrupt it    **/
 /**              disables global interrupt.                                 **/
@@ -299,221 +526,129 @@ void InterruptHandler_EnbleGlobalInterrupt(void)
     HAL_RegisterSetBit(INTCON_ADDRESS,BIT_6);
 }
 
-/* Interrupt Service Routine handler */
-#ifdef DRIVER_HANDLE_ISR
-void interrupt (void)
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_SetCallback the callback of  **/
+/**              specific interrupt source is registered.                   **/
+/**                                                                         **/
+/** Parameters: + InterruptSource => Enum value defined as                  **/
+/**                                  InterruptSourceType.                   **/
+/**             + Callback => Function called by the dispatch of its vector **/
+/**                           once the flag is cleared, NULL_PTR for none.  **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the callback is registered.  **/
+/**                           - E_NOT_OK: If the source is out of range.    **/
+/**                                                                         **/
+/** Note: Register it before enabling the source, a pointer isn't written   **/
+/**       in one instruction.                                               **/
+/*****************************************************************************/
+Std_ErrorType InterruptHandler_SetCallback(InterruptSourceType InterruptSource,
+                                           InterruptCallbackType Callback)
 {
-     uint8 _Temp;
-     _Temp=HAL_RegisterRead(INTCON_ADDRESS);
-#ifdef INTERRUPT_EXT_0
-     if(_Temp & (1<<INT0IF))
-     {
-          if(InterruptHandler_Flags[INT_EXT0]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_EXT0])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(INTCON_ADDRESS,INT0IF);
-     }
-#endif
-#ifdef TIMER_0_INTERRUPT
-     if(_Temp & (1<<TMR0IF))
-     {
-          if(InterruptHandler_Flags[INT_TMR0]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_TMR0])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(INTCON_ADDRESS,TMR0IF);
-     }
-#endif
-#ifdef RB_PORT_CHANGE_INTERRUPT
-     if(_Temp & (1<<RBIF))
-     {
-          if(InterruptHandler_Flags[INT_RB]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_RB])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(INTCON_ADDRESS,RBIF);
-     }
-#endif
-
-     _Temp=HAL_RegisterRead(INTCON3_ADDRESS);
+         if(InterruptSource >= INTERRUPT_SOURCES_NUMBER) return STD_ERROR;
+         InterruptHandler_Callbacks[InterruptSource]=Callback;
+         return STD_OK;
+}
 
-#ifdef INTERRUPT_EXT_1
-     if(_Temp & (1<<INT1IF))
-     {
-          if(InterruptHandler_Flags[INT_EXT1]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_EXT1])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(INTCON3_ADDRESS,INT1IF);
-     }
-#endif
-#ifdef INTERRUPT_EXT_2
-     if(_Temp & (1<<INT2IF))
-     {
-          if(InterruptHandler_Flags[INT_EXT2]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_EXT2])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(INTCON3_ADDRESS,INT2IF);
-     }
-#endif
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_EnablePriority IPEN is set:  **/
+/**              every source but INT0 (always high) goes on low priority,  **/
+/**              InterruptHandler_SetPriority raises the ones which can't   **/
+/**              wait.                                                      **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Call it before any source is enabled. GIE and PEIE become GIEH    **/
+/**       and GIEL, the global enable and disable set and clear both.       **/
+/*****************************************************************************/
+void InterruptHandler_EnablePriority(void)
+{
+     HAL_RegisterClearBit(INTCON2_ADDRESS,TMR0IP);
+     HAL_RegisterClearBit(INTCON2_ADDRESS,RBIP);
+     HAL_RegisterClearBit(INTCON3_ADDRESS,INT1IP);
+     HAL_RegisterClearBit(INTCON3_ADDRESS,INT2IP);
+     HAL_RegisterWrite(IPR1_ADDRESS,0x00);
+     HAL_RegisterWrite(IPR2_ADDRESS,0x00);
+     InterruptHandler_HighMask[INTERRUPT_INTCON]=1<<INT0IF;
+     InterruptHandler_HighMask[INTERRUPT_INTCON3]=0;
+     InterruptHandler_HighMask[INTERRUPT_PIR1]=0;
+     InterruptHandler_HighMask[INTERRUPT_PIR2]=0;
+     HAL_RegisterSetBit(RCON_ADDRESS,IPEN);
+}
 
-     _Temp=HAL_RegisterRead(PIR1_ADDRESS);
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_SetPriority the priority of  **/
+/**              specific interrupt source is selected.                     **/
+/**                                                                         **/
+/** Parameters: + InterruptSource => Enum value defined as                  **/
+/**                                  InterruptSourceType.                   **/
+/**             + Priority => Enum value defined as InterruptPriorityType.  **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the priority is selected.    **/
+/**                           - E_NOT_OK: If IPEN isn't set, INT0 on low    **/
+/**                                       priority or no source.            **/
+/**                                                                         **/
+/** Note: Select it while the source is disabled, the flag may be serviced  **/
+/**       by the vector it leaves.                                          **/
+/*****************************************************************************/
+Std_ErrorType InterruptHandler_SetPriority(InterruptSourceType InterruptSource,
+                                           InterruptPriorityType Priority)
+{
+         uint8 _Row;
+         uint8 _Bit;
 
-#ifdef TIMER_1_INTERRUPT
-     if(_Temp & (1<<TMR1IF))
-     {
-          if(InterruptHandler_Flags[INT_TMR1]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_TMR1])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,TMR1IF);
-     }
-#endif
-#ifdef TIMER_2_INTERRUPT
-     if(_Temp & (1<<TMR2IF))
-     {
-          if(InterruptHandler_Flags[INT_TMR2]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_TMR2])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,TMR2IF);
-     }
-#endif
-#ifdef CCP1_INTERRUPT
-     if(_Temp & (1<<CCP1IF))
-     {
-          if(InterruptHandler_Flags[INT_CCP1]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_CCP1])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,CCP1IF);
-     }
-#endif
-#ifdef MASTER_SNCHRONOUS_SERIAL_PORT_INTERRUPT
-     if(_Temp & (1<<SSPIF))
-     {
-          if(InterruptHandler_Flags[INT_SSP]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_SSP])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,SSPIF);
-     }
-#endif
-#ifdef EUSART_TRANSMIT_INTERRUPT
-     if(_Temp & (1<<TXIF))
-     {
-          if(InterruptHandler_Flags[INT_TX]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_TX])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,TXIF);
-     }
-#endif
-#ifdef EUSART_RECEIVE_INTERRUPT
-     if(_Temp & (1<<RCIF))
-     {
-          if(InterruptHandler_Flags[INT_RC]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_RC])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,RCIF);
-     }
-#endif
-#ifdef A_D_CONVERTER_INTERRUPT
-     if(_Temp & (1<<ADIF))
-     {
-          if(InterruptHandler_Flags[INT_AD]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_AD])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,ADIF);
-     }
-#endif
-#ifdef PARALLEL_SLAVE_PORT_READ_WRITE_INTERRUPT
-     if(_Temp & (1<<PSPIF))
-     {
-          if(InterruptHandler_Flags[INT_PSP]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_PSP])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR1_ADDRESS,PSPIF);
-     }
-#endif
+         if(InterruptSource == INT_EXT0)  /* No INT0IP, always high */
+               return (Priority == INT_HIGH_PRIORITY) ? STD_OK : STD_ERROR;
+         if(!(HAL_RegisterRead(RCON_ADDRESS) & (1<<IPEN))) return STD_ERROR;
 
-     _Temp=HAL_RegisterRead(PIR2_ADDRESS);
+         for(_Row=0; _Row<4; _Row++)
+         {
+               for(_Bit=0; _Bit<8; _Bit++)
+               {
+                     if(InterruptHandler_Sources[_Row][_Bit] != InterruptSource) continue;
+                     HAL_RegisterAssignBit(InterruptHandler_PriorityAddress[_Row],
+                                           _Bit+InterruptHandler_PriorityShift[_Row],
+                                           Priority);
+                     if(Priority == INT_HIGH_PRIORITY) InterruptHandler_HighMask[_Row] |=  (1<<_Bit);
+                     else                              InterruptHandler_HighMask[_Row] &=~ (1<<_Bit);
+                     return STD_OK;
+               }
+         }
+         return STD_ERROR;  /* No source */
+}
 
-#ifdef CCP2_INTERRUPT
-     if(_Temp & (1<<CCP2IF))
-     {
-          if(InterruptHandler_Flags[INT_CCP2]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_CCP2])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,CCP2IF);
-     }
-#endif
-#ifdef TMR3_INTERRUPT
-     if(_Temp & (1<<TMR3IF))
-     {
-          if(InterruptHandler_Flags[INT_TMR3]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_TMR3])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,TMR3IF);
-     }
-#endif
-#ifdef HIGH_LOW_VOLTAGE_DETECT_INTERRUPT
-     if(_Temp & (1<<HLVDIF))
-     {
-          if(InterruptHandler_Flags[INT_HLVD]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_HLVD])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,HLVDIF);
-     }
-#endif
-#ifdef BUS_COLLISION_INTERRUPT
-     if(_Temp & (1<<BCLIF))
-     {
-          if(InterruptHandler_Flags[INT_BCL]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_BCL])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,BCLIF);
-     }
-#endif
-#ifdef DATA_EEPROM_FLASH_WRITE_OPERATION_INTERRUPT
-     if(_Temp & (1<<EEIF))
-     {
-          if(InterruptHandler_Flags[INT_EE]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_EE])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,EEIF);
-     }
-#endif
-#ifdef COMPARATOR_INTERRUPT
-     if(_Temp & (1<<CMIF))
-     {
-          if(InterruptHandler_Flags[INT_CM]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_CM])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,CMIF);
-     }
-#endif
-#ifdef OSCILLATOR_FAIL_INTERRUPT
-     if(_Temp & (1<<OSCFIF))
-     {
-          if(InterruptHandler_Flags[INT_OSCF]!= NULL_PTR)
-          {
-                  *(InterruptHandler_Flags[INT_OSCF])=INT_HAPPENED;
-          }
-          HAL_RegisterClearBit(PIR2_ADDRESS,OSCFIF);
-     }
-#endif
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_DispatchHigh the pending     **/
+/**              high priority sources (flag and enable set) are serviced:  **/
+/**              each row with a high source is read once, then only the    **/
+/**              pending bits are looked up in InterruptHandler_Sources.    **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Called from the high priority interrupt routine only, it services **/
+/**       every source while IPEN is clear. A source which gets pending     **/
+/**       meanwhile is serviced by the next interrupt.                      **/
+/*****************************************************************************/
+void InterruptHandler_DispatchHigh(void)
+{
+     INTERRUPT_DISPATCH(INTERRUPT_HIGH_MASK);
+}
 
+/*****************************************************************************/
+/** Description: By a call to InterruptHandler_DispatchLow the pending low  **/
+/**              priority sources are serviced as by DispatchHigh.          **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Called from the low priority interrupt routine only, the high     **/
+/**       priority one can interrupt it.                                    **/
+/*****************************************************************************/
+void InterruptHandler_DispatchLow(void)
+{
+     INTERRUPT_DISPATCH(INTERRUPT_LOW_MASK);
 }
-#endif
\ No newline at end of file
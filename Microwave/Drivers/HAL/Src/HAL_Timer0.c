@@ -42,6 +42,12 @@
 #endif /* T0PS0 */
 
 
+/* Private variables */
+static uint16 Timer0_Reload;    /* Added to the count at every overflow */
+static uint8  Timer0_Lost;      /* Counts lost by a read-add-write of TMR0 */
+static uint8  Timer0_Is8Bits;
+static uint8  Timer0_Extended;  /* Period stretched by HAL_Timer0_extend */
+
 /* Private functions prototype */
 static Std_ErrorType Timer0_ErrorCheck(HAL_Timer0_ConfigType * Timer0_Config);
 
@@ -80,16 +86,26 @@ Std_ErrorType HAL_Timer0_init(HAL_Timer0_ConfigType * Timer0_Config)
       
       HAL_Timer0_stop();
       
+      Timer0_Extended=FALSE;
+      Timer0_Lost=0;
+      if(Timer0_Config->Timer0_Prescaler == TIMER0_PRESCALER_OFF)
+      {
+             Timer0_Lost=TIMER0_RELOAD_CYCLES; /* Counts are cycles */
+      }
+      Timer0_Reload=Timer0_Config->Timer0_Data+Timer0_Lost;
       switch(Timer0_Config->Timer0_DataSize) /* data size */
       {
              case TIMER0_16_BITS:
-                  _Reg_Temp &=~ (1<<TIMER0_8_BITS);
-                  HAL_RegisterWrite(TMR0L_BASE_ADDRESS,Timer0_Config->Timer0_Data);
+                  _Reg_Temp &=~ (1<<T08BIT);
+                  /* TMR0H is buffered, it is loaded by the TMR0L write */
                   HAL_RegisterWrite(TMR0H_BASE_ADDRESS,Timer0_Config->Timer0_Data>>8);
+                  HAL_RegisterWrite(TMR0L_BASE_ADDRESS,Timer0_Config->Timer0_Data);
+                  Timer0_Is8Bits=FALSE;
              break;
              case TIMER0_8_BITS:
-                  _Reg_Temp |=  (1<<TIMER0_8_BITS);
+                  _Reg_Temp |=  (1<<T08BIT);
                   HAL_RegisterWrite(TMR0L_BASE_ADDRESS,Timer0_Config->Timer0_Data);
+                  Timer0_Is8Bits=TRUE;
              break;
       }
 
@@ -107,54 +123,45 @@ Std_ErrorType HAL_Timer0_init(HAL_Timer0_ConfigType * Timer0_Config)
                   _Reg_Temp |=  (1<<T0SE);
              break;
       }
-      switch(Timer0_Config->Timer0_Prescaler)  /* set prescaler */
+      /* set prescaler, T0PS2:T0PS0 = 000 (1:2) .. 111 (1:256) */
+      if(Timer0_Config->Timer0_Prescaler == TIMER0_PRESCALER_OFF)
       {
-             case TIMER0_PRESCALER_OFF:
-                  _Reg_Temp |=  (1<<PSA);
-             break;
-             case TIMER0_PRESCALER_2:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp &=~ (7<<T0PS0);
-             break;
-             case TIMER0_PRESCALER_4:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp &=~ (7<<T0PS0);
-                  _Reg_Temp |=  (1<<T0PS0);
-             break;
-             case TIMER0_PRESCALER_8:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp &=~ (7<<T0PS0);
-                  _Reg_Temp |=  (1<<T0PS1);
-             break;
-             case TIMER0_PRESCALER_16:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp &=~ (7<<T0PS0);
-                  _Reg_Temp |=  (3<<T0PS0);
-             break;
-             case TIMER0_PRESCALER_32:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp &=~ (7<<T0PS0);
-                  _Reg_Temp |=  (1<<T0PS2);
-             break;
-             case TIMER0_PRESCALER_64:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp |=  (7<<T0PS0);
-                  _Reg_Temp &=~ (1<<T0PS1);
-             break;
-             case TIMER0_PRESCALER_128:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp |=  (7<<T0PS0);
-                  _Reg_Temp &=~ (1<<T0PS0);
-             break;
-             case TIMER0_PRESCALER_256:
-                  _Reg_Temp &=~ (1<<PSA);
-                  _Reg_Temp |=  (7<<T0PS0);
-             break;
+             _Reg_Temp |=  (1<<PSA);
+      }
+      else
+      {
+             _Reg_Temp |=  (Timer0_Config->Timer0_Prescaler-1)<<T0PS0;
       }
       HAL_RegisterWrite(T0CON_BASE_ADDRESS,_Reg_Temp); /* control Timer0 */
       return STD_OK;  /* Successful init*/
 }
 
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer0_initStatic Timer0 will be          **/
+/**              initialized with the compile-time configuration, T0CON     **/
+/**              first stops it then TMR0H is buffered till the TMR0L write.**/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: HAL_Timer0_initStatic just initialize Timer0 and doesn't start it **/
+/*****************************************************************************/
+void HAL_Timer0_initStatic(void)
+{
+      HAL_RegisterWrite(T0CON_BASE_ADDRESS,TIMER0_CONFIG_T0CON);
+      HAL_RegisterWrite(TMR0H_BASE_ADDRESS,TIMER0_CONFIG_RELOAD>>8);
+      HAL_RegisterWrite(TMR0L_BASE_ADDRESS,TIMER0_CONFIG_RELOAD&0xFF);
+#if TIMER0_CONFIG_PRESCALE == 1
+      Timer0_Lost=TIMER0_RELOAD_CYCLES; /* Counts are cycles */
+#else
+      Timer0_Lost=0;
+#endif
+      Timer0_Reload=TIMER0_CONFIG_RELOAD+Timer0_Lost;
+      Timer0_Is8Bits=FALSE;
+      Timer0_Extended=FALSE;
+}
+
 /*****************************************************************************/
 /** Description: By a call to HAL_Timer0_start Timer0 will start.           **/
 /**                                                                         **/
@@ -205,4 +212,116 @@ Std_ErrorType HAL_Timer0_updateConfig(HAL_Timer0_ConfigType * Timer0_Config)
      if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in init */
      
      HAL_Timer0_start();
-}
\ No newline at end of file
+     return STD_OK;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer0_reload The reload is added to the  **/
+/**              running count instead of overwriting it. Reading TMR0L     **/
+/**              latches TMR0H, the sum is written TMR0H first and TMR0L    **/
+/**              loads both. A stretched period goes back to the prescaler  **/
+/**              of the tick, its counts since the overflow rescaled.       **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Called from the Timer0 interrupt only.                            **/
+/*****************************************************************************/
+void HAL_Timer0_reload(void)
+{
+     uint16 _Count_Temp;
+
+     _Count_Temp=HAL_RegisterRead(TMR0L_BASE_ADDRESS);
+     if(Timer0_Is8Bits == TRUE)
+     {
+           HAL_RegisterWrite(TMR0L_BASE_ADDRESS,_Count_Temp+Timer0_Reload);
+           return;
+     }
+     _Count_Temp|=(uint16)HAL_RegisterRead(TMR0H_BASE_ADDRESS)<<8;
+     if(Timer0_Extended == TRUE)
+     {
+           _Count_Temp*=TIMER0_CONFIG_EXTEND_PRESCALE/TIMER0_CONFIG_PRESCALE;
+           HAL_RegisterWrite(T0CON_BASE_ADDRESS,TIMER0_CONFIG_T0CON|(1<<TMR0ON));
+           Timer0_Extended=FALSE;
+     }
+     _Count_Temp+=Timer0_Reload;
+     HAL_RegisterWrite(TMR0H_BASE_ADDRESS,_Count_Temp>>8);
+     HAL_RegisterWrite(TMR0L_BASE_ADDRESS,_Count_Temp);
+}
+
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer0_extend The Tcy left of the period  **/
+/**              which runs now and the added ones are loaded as counts of  **/
+/**              the extended prescaler, T0CON takes it after the TMR0L     **/
+/**              write which cleared the prescaler.                         **/
+/**                                                                         **/
+/** Parameters: + Timer0_Cycles => Tcy added to the running period.         **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Call it with interrupts disabled and TMR0IF clear, 16 bits        **/
+/**       compile-time configuration only (HAL_Timer0_initStatic).          **/
+/*****************************************************************************/
+void HAL_Timer0_extend(uint32 Timer0_Cycles)
+{
+     uint32 _Cycles_Temp;
+     uint16 _Count_Temp;
+
+     _Count_Temp=HAL_RegisterRead(TMR0L_BASE_ADDRESS);
+     _Count_Temp|=(uint16)HAL_RegisterRead(TMR0H_BASE_ADDRESS)<<8;
+     _Cycles_Temp=(0x10000UL-_Count_Temp)*TIMER0_CONFIG_PRESCALE+Timer0_Cycles-Timer0_Lost;
+     _Count_Temp=0x10000UL-_Cycles_Temp/TIMER0_CONFIG_EXTEND_PRESCALE;
+     HAL_RegisterWrite(TMR0H_BASE_ADDRESS,_Count_Temp>>8);
+     HAL_RegisterWrite(TMR0L_BASE_ADDRESS,_Count_Temp);
+     HAL_RegisterWrite(T0CON_BASE_ADDRESS,TIMER0_CONFIG_EXTEND_T0CON|(1<<TMR0ON));
+     Timer0_Extended=TRUE;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer0_getPrescale The prescaler which    **/
+/**              counts now is returned.                                    **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: uint16 => Tcy per count.                                        **/
+/*****************************************************************************/
+uint16 HAL_Timer0_getPrescale(void)
+{
+     if(Timer0_Extended == TRUE)      return TIMER0_CONFIG_EXTEND_PRESCALE;
+     return TIMER0_CONFIG_PRESCALE;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer0_read The count is read, TMR0L      **/
+/**              first to latch TMR0H.                                      **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: uint16 => The count.                                            **/
+/*****************************************************************************/
+uint16 HAL_Timer0_read(void)
+{
+     uint16 _Count_Temp;
+
+     _Count_Temp=HAL_RegisterRead(TMR0L_BASE_ADDRESS);
+     if(Timer0_Is8Bits == TRUE)      return _Count_Temp;
+     return _Count_Temp | ((uint16)HAL_RegisterRead(TMR0H_BASE_ADDRESS)<<8);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer0_write The count is loaded.         **/
+/**                                                                         **/
+/** Parameters: + Timer0_Count => The new count.                            **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer0_write(uint16 Timer0_Count)
+{
+     if(Timer0_Is8Bits == FALSE)
+     {
+           HAL_RegisterWrite(TMR0H_BASE_ADDRESS,Timer0_Count>>8);
+     }
+     HAL_RegisterWrite(TMR0L_BASE_ADDRESS,Timer0_Count);
+}
@@ -0,0 +1,226 @@
+/*****************************************************************************/
+/** File:    HAL_Timer1.c                                                   **/
+/**                                                                         **/
+/** Description: This file is the implementation of Timer1 Driver.          **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "HAL_Timer1.h"
+
+/* Macros */
+#define T1CON_BASE_ADDRESS 0x0FCD
+#define TMR1L_BASE_ADDRESS 0x0FCE
+#define TMR1H_BASE_ADDRESS 0x0FCF
+
+#ifndef RD16
+#define RD16     BIT_7
+#endif /* RD16 */
+#ifndef T1CKPS0
+#define T1CKPS0  BIT_4
+#endif /* T1CKPS0 */
+#ifndef T1OSCEN
+#define T1OSCEN  BIT_3
+#endif /* T1OSCEN */
+#ifndef T1SYNC
+#define T1SYNC   BIT_2
+#endif /* T1SYNC */
+#ifndef TMR1CS
+#define TMR1CS   BIT_1
+#endif /* TMR1CS */
+#ifndef TMR1ON
+#define TMR1ON   BIT_0
+#endif /* TMR1ON */
+
+
+/* Private variables */
+static uint16 Timer1_Reload;    /* Added to the count at every overflow */
+
+/* Private functions prototype */
+static Std_ErrorType Timer1_ErrorCheck(HAL_Timer1_ConfigType * Timer1_Config);
+
+/* Private functions defination */
+static Std_ErrorType Timer1_ErrorCheck(HAL_Timer1_ConfigType * Timer1_Config)
+{
+       if(Timer1_Config == NULL_PTR)                             return STD_ERROR;
+       if(Timer1_Config->Timer1_Prescaler > TIMER1_PRESCALER_8)  return STD_ERROR;
+       /* Asynchronous counts: only TMR1H may be written while it runs */
+       if((Timer1_Config->Timer1_Mode == TIMER1_OSCILLATOR)
+          && ((Timer1_Config->Timer1_Data & 0xFF) != 0))         return STD_ERROR;
+       return STD_OK;
+}
+
+ /* public functions defination */
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_init Timer1 will be initialized    **/
+/**              with configurations filled in passed pointerto struct.     **/
+/**                                                                         **/
+/** Parameters: + Timer1_Config => Pointer to HAL_Timer1_ConfigType which   **/
+/**                                is filled with needed configurations     **/
+/**                                defined in HAL_Timer1_ConfigType         **/
+/**                                structure.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK: When all configurations filled      **/
+/**                                     with correct data.                  **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer     **/
+/**                                                                         **/
+/** Note: HAL_Timer1_init just initialize Timer1 and doesn't start it. The  **/
+/**       8 bits access (RD16 clear) is kept so TMR1H alone can be written. **/
+/*****************************************************************************/
+Std_ErrorType HAL_Timer1_init(HAL_Timer1_ConfigType * Timer1_Config)
+{
+       Std_ErrorType _Function_Return;
+       uint8 _Reg_Temp=0;
+
+       /* Check parameters */
+      _Function_Return= Timer1_ErrorCheck(Timer1_Config);
+      if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
+
+      HAL_Timer1_stop();
+
+      Timer1_Reload=Timer1_Config->Timer1_Data;
+      HAL_RegisterWrite(TMR1H_BASE_ADDRESS,Timer1_Config->Timer1_Data>>8);
+      HAL_RegisterWrite(TMR1L_BASE_ADDRESS,Timer1_Config->Timer1_Data);
+
+      switch(Timer1_Config->Timer1_Mode)  /* set mode */
+      {
+             case TIMER1_TIMER:
+                  _Reg_Temp &=~ (1<<TMR1CS);
+             break;
+             case TIMER1_COUNTER:
+                  _Reg_Temp |=  (1<<TMR1CS);
+                  _Reg_Temp &=~ (1<<T1SYNC);
+             break;
+             case TIMER1_OSCILLATOR:
+                  _Reg_Temp |=  (1<<TMR1CS);
+                  _Reg_Temp |=  (1<<T1SYNC);   /* Keeps counting in sleep */
+                  _Reg_Temp |=  (1<<T1OSCEN);
+             break;
+      }
+      _Reg_Temp |= Timer1_Config->Timer1_Prescaler<<T1CKPS0;  /* set prescaler */
+      HAL_RegisterWrite(T1CON_BASE_ADDRESS,_Reg_Temp); /* control Timer1 */
+      return STD_OK;  /* Successful init*/
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_start Timer1 will start.           **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer1_start(void)
+{
+      HAL_RegisterSetBit(T1CON_BASE_ADDRESS,TMR1ON);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_stop Timer1 will stop, T1OSCEN is  **/
+/**              kept so the crystal doesn't need to start up again.        **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer1_stop(void)
+{
+     HAL_RegisterClearBit(T1CON_BASE_ADDRESS,TMR1ON);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_updateConfig Timer1                **/
+/**              configurations will be updated with configurations filled  **/
+/**              in passed pointerto struct.                                **/
+/**                                                                         **/
+/** Parameters: + Timer1_Config => Pointer to HAL_Timer1_ConfigType which   **/
+/**                                is filled with needed configurations     **/
+/**                                defined in HAL_Timer1_ConfigType         **/
+/**                                structure.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK: When all configurations filled      **/
+/**                                     with correct data.                  **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer     **/
+/**                                                                         **/
+/** Note: HAL_Timer1_updateConfig = HAL_Timer1_init + HAL_Timer1_start.     **/
+/*****************************************************************************/
+Std_ErrorType HAL_Timer1_updateConfig(HAL_Timer1_ConfigType * Timer1_Config)
+{
+     Std_ErrorType _Function_Return;
+
+     _Function_Return=HAL_Timer1_init(Timer1_Config);
+     if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in init */
+
+     HAL_Timer1_start();
+     return STD_OK;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_reload The reload is added to the  **/
+/**              running count instead of overwriting it. A reload with     **/
+/**              low byte 0 is set in TMR1H by one bsf/iorwf, it is right   **/
+/**              while TMR1H is still below its lowest bit. Otherwise the   **/
+/**              16 bits sum is written TMR1H first (synchronous modes).    **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Called from the Timer1 interrupt only.                            **/
+/*****************************************************************************/
+void HAL_Timer1_reload(void)
+{
+     uint16 _Count_Temp;
+
+     if((Timer1_Reload & 0xFF) == 0)
+     {
+           HAL_RegisterSetMask(TMR1H_BASE_ADDRESS,Timer1_Reload>>8);
+           return;
+     }
+     _Count_Temp=HAL_RegisterRead(TMR1L_BASE_ADDRESS);
+     _Count_Temp|=(uint16)HAL_RegisterRead(TMR1H_BASE_ADDRESS)<<8;
+     _Count_Temp+=Timer1_Reload;
+     HAL_RegisterWrite(TMR1H_BASE_ADDRESS,_Count_Temp>>8);
+     HAL_RegisterWrite(TMR1L_BASE_ADDRESS,_Count_Temp);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_read The count is read high, low   **/
+/**              and high again (8 bits access), a carry from TMR1L in      **/
+/**              between reads it again.                                    **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: uint16 => The count.                                            **/
+/*****************************************************************************/
+uint16 HAL_Timer1_read(void)
+{
+     uint8 _High;
+     uint8 _Low;
+
+     do
+     {
+           _High=HAL_RegisterRead(TMR1H_BASE_ADDRESS);
+           _Low =HAL_RegisterRead(TMR1L_BASE_ADDRESS);
+     }while(_High != HAL_RegisterRead(TMR1H_BASE_ADDRESS));
+     return ((uint16)_High<<8) | _Low;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer1_write The count is loaded.         **/
+/**                                                                         **/
+/** Parameters: + Timer1_Count => The new count.                            **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer1_write(uint16 Timer1_Count)
+{
+     HAL_RegisterWrite(TMR1H_BASE_ADDRESS,Timer1_Count>>8);
+     HAL_RegisterWrite(TMR1L_BASE_ADDRESS,Timer1_Count);
+}
@@ -0,0 +1,153 @@
+/*****************************************************************************/
+/** File:    HAL_Timer2.c                                                   **/
+/**                                                                         **/
+/** Description: This file is the implementation of Timer2 Driver.          **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "HAL_Timer2.h"
+
+/* Macros */
+#define T2CON_BASE_ADDRESS 0x0FCA
+#define PR2_BASE_ADDRESS   0x0FCB
+#define TMR2_BASE_ADDRESS  0x0FCC
+
+#ifndef T2OUTPS0
+#define T2OUTPS0 BIT_3
+#endif /* T2OUTPS0 */
+#ifndef TMR2ON
+#define TMR2ON   BIT_2
+#endif /* TMR2ON */
+#ifndef T2CKPS0
+#define T2CKPS0  BIT_0
+#endif /* T2CKPS0 */
+
+
+/* Private functions prototype */
+static Std_ErrorType Timer2_ErrorCheck(HAL_Timer2_ConfigType * Timer2_Config);
+
+/* Private functions defination */
+static Std_ErrorType Timer2_ErrorCheck(HAL_Timer2_ConfigType * Timer2_Config)
+{
+       if(Timer2_Config == NULL_PTR)                             return STD_ERROR;
+       if(Timer2_Config->Timer2_Prescaler > TIMER2_PRESCALER_16) return STD_ERROR;
+       if(Timer2_Config->Timer2_Postscaler == 0 ||
+          Timer2_Config->Timer2_Postscaler > 16)                 return STD_ERROR;
+       return STD_OK;
+}
+
+ /* public functions defination */
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer2_init Timer2 will be initialized    **/
+/**              with configurations filled in passed pointerto struct.     **/
+/**                                                                         **/
+/** Parameters: + Timer2_Config => Pointer to HAL_Timer2_ConfigType which   **/
+/**                                is filled with needed configurations     **/
+/**                                defined in HAL_Timer2_ConfigType         **/
+/**                                structure.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK: When all configurations filled      **/
+/**                                     with correct data.                  **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer     **/
+/**                                                                         **/
+/** Note: HAL_Timer2_init just initialize Timer2 and doesn't start it, the  **/
+/**       T2CON write stops it and clears the prescaler and postscaler.     **/
+/*****************************************************************************/
+Std_ErrorType HAL_Timer2_init(HAL_Timer2_ConfigType * Timer2_Config)
+{
+       Std_ErrorType _Function_Return;
+
+       /* Check parameters */
+      _Function_Return= Timer2_ErrorCheck(Timer2_Config);
+      if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
+
+      HAL_RegisterWrite(T2CON_BASE_ADDRESS,
+                        ((Timer2_Config->Timer2_Postscaler-1)<<T2OUTPS0) |
+                        (Timer2_Config->Timer2_Prescaler<<T2CKPS0)); /* control Timer2 */
+      HAL_RegisterWrite(PR2_BASE_ADDRESS,Timer2_Config->Timer2_Period);
+      HAL_RegisterWrite(TMR2_BASE_ADDRESS,0x00);
+      return STD_OK;  /* Successful init*/
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer2_start Timer2 will start.           **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer2_start(void)
+{
+      HAL_RegisterSetBit(T2CON_BASE_ADDRESS,TMR2ON);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer2_stop Timer2 will stop.             **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer2_stop(void)
+{
+     HAL_RegisterClearBit(T2CON_BASE_ADDRESS,TMR2ON);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer2_updateConfig Timer2                **/
+/**              configurations will be updated with configurations filled  **/
+/**              in passed pointerto struct.                                **/
+/**                                                                         **/
+/** Parameters: + Timer2_Config => Pointer to HAL_Timer2_ConfigType which   **/
+/**                                is filled with needed configurations     **/
+/**                                defined in HAL_Timer2_ConfigType         **/
+/**                                structure.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK: When all configurations filled      **/
+/**                                     with correct data.                  **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer     **/
+/**                                                                         **/
+/** Note: HAL_Timer2_updateConfig = HAL_Timer2_init + HAL_Timer2_start.     **/
+/*****************************************************************************/
+Std_ErrorType HAL_Timer2_updateConfig(HAL_Timer2_ConfigType * Timer2_Config)
+{
+     Std_ErrorType _Function_Return;
+
+     _Function_Return=HAL_Timer2_init(Timer2_Config);
+     if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in init */
+
+     HAL_Timer2_start();
+     return STD_OK;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer2_read TMR2 is read.                 **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: uint8 => The count.                                             **/
+/*****************************************************************************/
+uint8 HAL_Timer2_read(void)
+{
+     return HAL_RegisterRead(TMR2_BASE_ADDRESS);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer2_write TMR2 is loaded.              **/
+/**                                                                         **/
+/** Parameters: + Timer2_Count => The new count.                            **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer2_write(uint8 Timer2_Count)
+{
+     HAL_RegisterWrite(TMR2_BASE_ADDRESS,Timer2_Count);
+}
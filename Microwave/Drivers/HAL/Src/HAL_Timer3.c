@@ -0,0 +1,231 @@
+/*****************************************************************************/
+/** File:    HAL_Timer3.c                                                   **/
+/**                                                                         **/
+/** Description: This file is the implementation of Timer3 Driver.          **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "HAL_Timer3.h"
+
+/* Macros */
+#define T3CON_BASE_ADDRESS 0x0FB1
+#define TMR3L_BASE_ADDRESS 0x0FB2
+#define TMR3H_BASE_ADDRESS 0x0FB3
+
+#ifndef RD16
+#define RD16     BIT_7
+#endif /* RD16 */
+#ifndef T3CKPS0
+#define T3CKPS0  BIT_4
+#endif /* T3CKPS0 */
+#ifndef T3SYNC
+#define T3SYNC   BIT_2
+#endif /* T3SYNC */
+#ifndef TMR3CS
+#define TMR3CS   BIT_1
+#endif /* TMR3CS */
+#ifndef TMR3ON
+#define TMR3ON   BIT_0
+#endif /* TMR3ON */
+
+
+/* Private variables */
+static uint16 Timer3_Reload;    /* Added to the count at every overflow */
+static uint8  Timer3_Rd16;      /* TRUE: a TMR3L read/write latches TMR3H */
+
+/* Private functions prototype */
+static Std_ErrorType Timer3_ErrorCheck(HAL_Timer3_ConfigType * Timer3_Config);
+
+/* Private functions defination */
+static Std_ErrorType Timer3_ErrorCheck(HAL_Timer3_ConfigType * Timer3_Config)
+{
+       if(Timer3_Config == NULL_PTR)                             return STD_ERROR;
+       if(Timer3_Config->Timer3_Prescaler > TIMER3_PRESCALER_8)  return STD_ERROR;
+       /* Asynchronous counts: only TMR3H may be written while it runs */
+       if((Timer3_Config->Timer3_Mode == TIMER3_OSCILLATOR)
+          && ((Timer3_Config->Timer3_Data & 0xFF) != 0))         return STD_ERROR;
+       return STD_OK;
+}
+
+ /* public functions defination */
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_init Timer3 will be initialized    **/
+/**              with configurations filled in passed pointerto struct.     **/
+/**                                                                         **/
+/** Parameters: + Timer3_Config => Pointer to HAL_Timer3_ConfigType which   **/
+/**                                is filled with needed configurations     **/
+/**                                defined in HAL_Timer3_ConfigType         **/
+/**                                structure.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK: When all configurations filled      **/
+/**                                     with correct data.                  **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer     **/
+/**                                                                         **/
+/** Note: HAL_Timer3_init just initialize Timer3 and doesn't start it. The  **/
+/**       synchronous TIMER3_TIMER sets RD16 for one-read 16 bits counts,   **/
+/**       the other modes keep 8 bits access so TMR3H alone can be written. **/
+/**       T3CCP2:T3CCP1 clear leave Timer1 to both CCP modules.             **/
+/*****************************************************************************/
+Std_ErrorType HAL_Timer3_init(HAL_Timer3_ConfigType * Timer3_Config)
+{
+       Std_ErrorType _Function_Return;
+       uint8 _Reg_Temp=0;
+
+       /* Check parameters */
+      _Function_Return= Timer3_ErrorCheck(Timer3_Config);
+      if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
+
+      HAL_Timer3_stop();
+
+      Timer3_Reload=Timer3_Config->Timer3_Data;
+      HAL_RegisterWrite(TMR3H_BASE_ADDRESS,Timer3_Config->Timer3_Data>>8);
+      HAL_RegisterWrite(TMR3L_BASE_ADDRESS,Timer3_Config->Timer3_Data);
+
+      switch(Timer3_Config->Timer3_Mode)  /* set mode */
+      {
+             case TIMER3_TIMER:
+                  _Reg_Temp &=~ (1<<TMR3CS);
+                  _Reg_Temp |=  (1<<RD16);     /* 16 bits read/write */
+             break;
+             case TIMER3_COUNTER:
+                  _Reg_Temp |=  (1<<TMR3CS);
+                  _Reg_Temp &=~ (1<<T3SYNC);
+             break;
+             case TIMER3_OSCILLATOR:
+                  _Reg_Temp |=  (1<<TMR3CS);
+                  _Reg_Temp |=  (1<<T3SYNC);   /* Keeps counting in sleep */
+             break;
+      }
+      Timer3_Rd16=(Timer3_Config->Timer3_Mode == TIMER3_TIMER);
+      _Reg_Temp |= Timer3_Config->Timer3_Prescaler<<T3CKPS0;  /* set prescaler */
+      HAL_RegisterWrite(T3CON_BASE_ADDRESS,_Reg_Temp); /* control Timer3 */
+      return STD_OK;  /* Successful init*/
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_start Timer3 will start.           **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer3_start(void)
+{
+      HAL_RegisterSetBit(T3CON_BASE_ADDRESS,TMR3ON);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_stop Timer3 will stop.             **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer3_stop(void)
+{
+     HAL_RegisterClearBit(T3CON_BASE_ADDRESS,TMR3ON);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_updateConfig Timer3                **/
+/**              configurations will be updated with configurations filled  **/
+/**              in passed pointerto struct.                                **/
+/**                                                                         **/
+/** Parameters: + Timer3_Config => Pointer to HAL_Timer3_ConfigType which   **/
+/**                                is filled with needed configurations     **/
+/**                                defined in HAL_Timer3_ConfigType         **/
+/**                                structure.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK: When all configurations filled      **/
+/**                                     with correct data.                  **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer     **/
+/**                                                                         **/
+/** Note: HAL_Timer3_updateConfig = HAL_Timer3_init + HAL_Timer3_start.     **/
+/*****************************************************************************/
+Std_ErrorType HAL_Timer3_updateConfig(HAL_Timer3_ConfigType * Timer3_Config)
+{
+     Std_ErrorType _Function_Return;
+
+     _Function_Return=HAL_Timer3_init(Timer3_Config);
+     if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in init */
+
+     HAL_Timer3_start();
+     return STD_OK;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_reload The reload is added to the  **/
+/**              running count instead of overwriting it. A reload with     **/
+/**              low byte 0 is set in TMR3H by one bsf/iorwf, it is right   **/
+/**              while TMR3H is still below its lowest bit (8 bits access). **/
+/**              Otherwise the 16 bits sum is written TMR3H first.          **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/**                                                                         **/
+/** Note: Called from the Timer3 interrupt only.                            **/
+/*****************************************************************************/
+void HAL_Timer3_reload(void)
+{
+     uint16 _Count_Temp;
+
+     if(Timer3_Rd16 == FALSE && (Timer3_Reload & 0xFF) == 0)
+     {
+           HAL_RegisterSetMask(TMR3H_BASE_ADDRESS,Timer3_Reload>>8);
+           return;
+     }
+     _Count_Temp=HAL_RegisterRead(TMR3L_BASE_ADDRESS);
+     _Count_Temp|=(uint16)HAL_RegisterRead(TMR3H_BASE_ADDRESS)<<8;
+     _Count_Temp+=Timer3_Reload;
+     HAL_RegisterWrite(TMR3H_BASE_ADDRESS,_Count_Temp>>8);
+     HAL_RegisterWrite(TMR3L_BASE_ADDRESS,_Count_Temp);
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_read The count is read TMR3L       **/
+/**              first with RD16 set (TMR3H latched). Else high, low and    **/
+/**              high again, a carry from TMR3L in between reads it again.  **/
+/**                                                                         **/
+/** Parameters: None.                                                       **/
+/**                                                                         **/
+/** Return: uint16 => The count.                                            **/
+/*****************************************************************************/
+uint16 HAL_Timer3_read(void)
+{
+     uint8 _High;
+     uint8 _Low;
+
+     if(Timer3_Rd16)
+     {
+           _Low=HAL_RegisterRead(TMR3L_BASE_ADDRESS);
+           return ((uint16)HAL_RegisterRead(TMR3H_BASE_ADDRESS)<<8) | _Low;
+     }
+     do
+     {
+           _High=HAL_RegisterRead(TMR3H_BASE_ADDRESS);
+           _Low =HAL_RegisterRead(TMR3L_BASE_ADDRESS);
+     }while(_High != HAL_RegisterRead(TMR3H_BASE_ADDRESS));
+     return ((uint16)_High<<8) | _Low;
+}
+
+/*****************************************************************************/
+/** Description: By a call to HAL_Timer3_write The count is loaded.         **/
+/**                                                                         **/
+/** Parameters: + Timer3_Count => The new count.                            **/
+/**                                                                         **/
+/** Return: None.                                                           **/
+/*****************************************************************************/
+void HAL_Timer3_write(uint16 Timer3_Count)
+{
+     HAL_RegisterWrite(TMR3H_BASE_ADDRESS,Timer3_Count>>8);
+     HAL_RegisterWrite(TMR3L_BASE_ADDRESS,Timer3_Count);
+}
@@ -25,10 +25,18 @@
 typedef bit                     boolean;
 typedef char                    sint8;
 typedef unsigned char           uint8;
+#ifdef HOST_SIMULATION
+/* Host build: keep the 16/32 bits widths of mikroC int and long */
+typedef signed short            sint16;
+typedef unsigned short          uint16;
+typedef signed int              sint32;
+typedef unsigned int            uint32;
+#else
 typedef signed int              sint16;
 typedef unsigned int            uint16;
 typedef signed long             sint32;
 typedef unsigned long           uint32;
+#endif
 typedef signed long long        sint64;
 typedef unsigned long long      uint64;
 typedef float                   float32;
@@ -0,0 +1,125 @@
+/*****************************************************************************/
+/** File:    Module_Debounce.h                                              **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the debouncer, it      **/
+/**              debounces all pins of a port in parallel with 2 bits       **/
+/**              vertical counters (one sample per tick).                   **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _MODULE_DEBOUNCE_H_
+#define _MODULE_DEBOUNCE_H_
+
+/* Inclusion */
+#include "HAL_GPIO.h"
+
+/* Macros */
+/* Samples at a new level before it is stable (2..4). With the 25 ms tick */
+/* 2 samples filter bounces shorter than 25 ms within 25..50 ms.          */
+#ifndef DEBOUNCE_SAMPLES
+#define DEBOUNCE_SAMPLES  2
+#endif
+#if (DEBOUNCE_SAMPLES < 2) || (DEBOUNCE_SAMPLES > 4)
+#error "DEBOUNCE_SAMPLES must be 2, 3 or 4"
+#endif
+/* Reset value of the counters (DEBOUNCE_SAMPLES-1) as bit planes */
+#define DEBOUNCE_RESET_COUNT0  ((((DEBOUNCE_SAMPLES)-1) & 0x01) ? 0xFF : 0x00)
+#define DEBOUNCE_RESET_COUNT1  ((((DEBOUNCE_SAMPLES)-1) & 0x02) ? 0xFF : 0x00)
+
+/* Queries of the debounced ports, PIN_DEF is "PORTx_BASE_ADDRESS,PIN_n" */
+/* Stable level (HIGH or LOW), updated every tick */
+#define DEBOUNCE_PIN_READ(PIN_DEF)          DEBOUNCE_PIN_READ_(PIN_DEF)
+/* Edges of this pass, taken by Debounce_takeEvents */
+#define DEBOUNCE_PIN_FELL(PIN_DEF)          DEBOUNCE_PIN_FELL_(PIN_DEF)
+#define DEBOUNCE_PIN_ROSE(PIN_DEF)          DEBOUNCE_PIN_ROSE_(PIN_DEF)
+
+/* Expansion helpers, PIN_DEF is split in port and pin here */
+#define DEBOUNCE_PIN_READ_(PORT,PIN)        \
+((Debounce_Ports[GPIO_PORT_INDEX(PORT)].stable & (1<<(PIN))) ? HIGH : LOW)
+#define DEBOUNCE_PIN_FELL_(PORT,PIN)        \
+(Debounce_PortsFell[GPIO_PORT_INDEX(PORT)] & (1<<(PIN)))
+#define DEBOUNCE_PIN_ROSE_(PORT,PIN)        \
+(Debounce_PortsRose[GPIO_PORT_INDEX(PORT)] & (1<<(PIN)))
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is the debounce state of 8 inputs (one bit each).     **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - stable   => Debounced levels.                               **/
+/**           - count0   => Bit 0 of the vertical counters.                 **/
+/**           - count1   => Bit 1 of the vertical counters.                 **/
+/**           - fell     => Pending HIGH to LOW edges of stable.            **/
+/**           - rose     => Pending LOW to HIGH edges of stable.            **/
+/*****************************************************************************/
+typedef struct{
+        uint8 stable;
+        uint8 count0;
+        uint8 count1;
+        uint8 fell;
+        uint8 rose;
+}Debounce_ChannelType;
+
+/* Externed variables */
+extern Debounce_ChannelType Debounce_Ports[GPIO_NUMBER_OF_PORTS];
+extern uint8 Debounce_PortsFell[GPIO_NUMBER_OF_PORTS];  /* Edges of this pass */
+extern uint8 Debounce_PortsRose[GPIO_NUMBER_OF_PORTS];  /* Edges of this pass */
+
+/* Functions prototype */
+/**
+  * @brief	By a call to Debounce_channelInit The passed channel will start 
+  *			stable at the passed levels with no pending edges.
+  *	@param	Debounce_Channel Pointer to Debounce_ChannelType.
+  *	@param	Levels The current levels of the 8 inputs.
+  */
+void Debounce_channelInit(Debounce_ChannelType * Debounce_Channel, uint8 Levels);
+
+/**
+  * @brief	By a call to Debounce_channelSample One sample of the 8 inputs 
+  *			is counted, an input which differs from its stable level for 
+  *			DEBOUNCE_SAMPLES samples in a row changes and records an edge.
+  *	@param	Debounce_Channel Pointer to Debounce_ChannelType.
+  *	@param	Sample The sampled levels of the 8 inputs.
+  */
+void Debounce_channelSample(Debounce_ChannelType * Debounce_Channel, uint8 Sample);
+
+/**
+  * @brief	By a call to Debounce_init The passed ports are debounced by 
+  *			Debounce_update and start stable at their current levels. 
+  *	@param	PortsMask GPIO_PORT_MASK of the debounced ports.
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType Debounce_init(uint8 PortsMask);
+
+/**
+  * @brief	By a call to Debounce_reset The debounced ports restart stable at 
+  *			their current levels and pending edges are dropped (after sleep). 
+  *			Interrupts are disabled while it runs, from main context only.
+  */
+void Debounce_reset(void);
+
+/**
+  * @brief	By a call to Debounce_update every debounced port is read once and 
+  *			sampled. To be called every tick from the timer interrupt. 
+  */
+void Debounce_update(void);
+
+/**
+  * @brief	By a call to Debounce_takeEvents the pending edges are moved to 
+  *			Debounce_PortsFell/Debounce_PortsRose for this pass. Every edge 
+  *			is seen by one pass only. To be called from main context.
+  */
+void Debounce_takeEvents(void);
+
+/**
+  * @brief	By a call to Debounce_isSettled it is known if no debounced input 
+  *			is moving, then the ticks can be slowed down until an input changes. 
+  *	@return	TRUE if all counters are at rest, FALSE otherwise.
+  */
+uint8 Debounce_isSettled(void);
+
+#endif /* _MODULE_DEBOUNCE_H_ */
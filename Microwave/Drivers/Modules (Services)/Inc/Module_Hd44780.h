@@ -0,0 +1,108 @@
+/*****************************************************************************/
+/** File:    Module_Hd44780.h                                               **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the HD44780 LCD       **/
+/**              driver (4 bits bus), it replaces the mikroC PRO Lcd        **/
+/**              library: the init and the bus primitives, the text goes    **/
+/**              through the LCD buffer and queue. With LCD_RW_WIRED the    **/
+/**              busy flag is read, else the worst-case execution times     **/
+/**              are waited.                                                **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _MODULE_HD44780_H_
+#define _MODULE_HD44780_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+#include "HAL_GPIO.h"
+#include "Pins_Config.h"
+
+/* Macros */
+/* Commands */
+#define HD44780_CLEAR           0x01  /* Clear display, cursor home */
+#define HD44780_RETURN_HOME     0x02
+#define HD44780_ENTRY_MODE      0x06  /* Cursor moves right, no shift */
+#define HD44780_DISPLAY_OFF     0x08
+#define HD44780_DISPLAY_ON      0x0C  /* Cursor and blink off */
+#define HD44780_FUNCTION_SET    0x28  /* 4 bits bus, 2 lines, 5x8 dots */
+#define HD44780_SET_ADDRESS     0x80  /* | DDRAM address */
+
+/* DDRAM address of column 1 of every row (4x16 glass) */
+#define HD44780_ROWS            4
+#define HD44780_COLUMNS         16
+#define HD44780_ROW1_ADDRESS    0x00
+#define HD44780_ROW2_ADDRESS    0x40
+#define HD44780_ROW3_ADDRESS    0x10
+#define HD44780_ROW4_ADDRESS    0x50
+
+/* Worst-case execution times, slowest LCD clock (fosc = 190 kHz) */
+#define HD44780_EXECUTION_US    53    /* 37 us at 270 kHz */
+#define HD44780_CLEAR_US        2160  /* Clear display and return home, 1.52 ms at 270 kHz */
+
+/* D4..D7 are LCD_D4_PIN and the next 3 pins of its port */
+#define HD44780_DATA_PORT       HD44780_PORT_OF(LCD_D4_PIN)
+#define HD44780_DATA_SHIFT      HD44780_PIN_OF(LCD_D4_PIN)
+#define HD44780_DATA_LATCH      (HD44780_DATA_PORT+PORT_LATCH_OFFSET)
+#define HD44780_DATA_MASK       (0x0F<<HD44780_DATA_SHIFT)
+#define HD44780_DATA_DIRECTION  (HD44780_DATA_PORT+PORT_DIRECTION_OFFSET)
+#define HD44780_BUSY_MASK       (0x08<<HD44780_DATA_SHIFT) /* D7 of the high nibble */
+#define HD44780_PORT_OF(PIN_DEF)    HD44780_PORT_OF_(PIN_DEF)
+#define HD44780_PIN_OF(PIN_DEF)     HD44780_PIN_OF_(PIN_DEF)
+#define HD44780_PORT_OF_(PORT,PIN)  (PORT)
+#define HD44780_PIN_OF_(PORT,PIN)   (PIN)
+#if (HD44780_DATA_SHIFT > 4)
+#error "LCD_D4_PIN must leave 3 pins above it for D5..D7"
+#endif
+#if GPIO_PORT_SHADOWED(HD44780_DATA_PORT)
+#error "The LCD data port can't be in GPIO_LATCH_SHADOW_PORTS"
+#endif
+
+/* Bus primitives, macros so the driver (main) and the LCD queue (interrupt) */
+/* share no function. D4..D7 are one masked LATx write, the other pins of  */
+/* the port keep their level. EN is HIGH one cycle (0.5 us > 230 ns) and  */
+/* the nibble is taken on its falling edge.                               */
+#define HD44780_WRITE_NIBBLE(NIBBLE)  \
+HAL_RegisterWrite(HD44780_DATA_LATCH,                                         \
+                  (HAL_RegisterRead(HD44780_DATA_LATCH) & ~HD44780_DATA_MASK) | \
+                  (((NIBBLE) & 0x0F)<<HD44780_DATA_SHIFT))
+#define HD44780_PULSE_ENABLE()  \
+do{ GPIO_PIN_SET(LCD_EN_PIN); GPIO_PIN_CLEAR(LCD_EN_PIN); }while(0)
+/* One byte, high nibble first. RS: 0 => command, else character */
+#define HD44780_WRITE_BYTE(RS,VALUE)  do{                                      \
+      GPIO_PIN_ASSIGN(LCD_RS_PIN,RS);                                         \
+      HD44780_WRITE_NIBBLE((VALUE)>>4);                                       \
+      HD44780_PULSE_ENABLE();                                                 \
+      HD44780_WRITE_NIBBLE(VALUE);                                            \
+      HD44780_PULSE_ENABLE();                                                 \
+}while(0)
+#if LCD_RW_WIRED
+/* BUSY is non zero while the last instruction runs. D4..D7 are inputs    */
+/* while R/W is HIGH, D7 is read with EN HIGH (valid 360 ns after the     */
+/* rise), the second nibble (address counter) is clocked out unread.     */
+#define HD44780_READ_BUSY(BUSY)  do{                                           \
+      HAL_RegisterSetMask(HD44780_DATA_DIRECTION,HD44780_DATA_MASK);          \
+      GPIO_PIN_CLEAR(LCD_RS_PIN);                                             \
+      GPIO_PIN_SET(LCD_RW_PIN);                                               \
+      GPIO_PIN_SET(LCD_EN_PIN);                                               \
+      (BUSY)=HAL_RegisterRead(HD44780_DATA_PORT) & HD44780_BUSY_MASK;         \
+      GPIO_PIN_CLEAR(LCD_EN_PIN);                                             \
+      HD44780_PULSE_ENABLE();                                                 \
+      GPIO_PIN_CLEAR(LCD_RW_PIN);                                             \
+      HAL_RegisterClearMask(HD44780_DATA_DIRECTION,HD44780_DATA_MASK);        \
+}while(0)
+#endif
+
+/* Functions prototype */
+/**
+  * @brief	By a call to Hd44780_init The LCD pins are outputs, the LCD is
+  *			set to 4 bits mode by instruction (power on wait included),
+  *			cleared and turned on without cursor. The busy flag can't be
+  *			read before the 4 bits function set, the reset waits are fixed.
+  */
+void Hd44780_init(void);
+
+#endif /* _MODULE_HD44780_H_ */
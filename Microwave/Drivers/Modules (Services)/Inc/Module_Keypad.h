@@ -13,16 +13,73 @@
 
 /* Inclusion */
 #include "HAL_GPIO.h"
+#include "Module_Debounce.h"
 
 /* Macros */
 #define KEYPAD_MAX_COL_NUMBER 3
 #define KEYPAD_MAX_ROW_NUMBER 4
+#define KEYPAD_MAX_KEYS_NUMBER (KEYPAD_MAX_ROW_NUMBER*KEYPAD_MAX_COL_NUMBER)
 
 #define KEYPAD_NOT_PRESSED 0
 
+/* One debounce bit per key, key index = row*colsNumber + col */
+#define KEYPAD_DEBOUNCE_CHANNELS  ((KEYPAD_MAX_KEYS_NUMBER+7)/8)
+
+/* Events queued by Keypad_update, a power of 2 (one slot stays free) */
+#ifndef KEYPAD_EVENTS_NUMBER
+#define KEYPAD_EVENTS_NUMBER  16
+#endif
+#if (KEYPAD_EVENTS_NUMBER & (KEYPAD_EVENTS_NUMBER-1)) || (KEYPAD_EVENTS_NUMBER > 128)
+#error "KEYPAD_EVENTS_NUMBER must be a power of 2 up to 128"
+#endif
+/* Ticks of Keypad_update a key is held before KEYPAD_EVENT_HOLD (1 s at 25 ms) */
+#ifndef KEYPAD_HOLD_TICKS
+#define KEYPAD_HOLD_TICKS     40
+#endif
+/* Ticks between KEYPAD_EVENT_REPEAT while the key stays held (200 ms) */
+#ifndef KEYPAD_REPEAT_TICKS
+#define KEYPAD_REPEAT_TICKS   8
+#endif
+
+#define KEYPAD_NO_KEY         0xFF  /* heldKey when no key is held */
+
 /* Data types defination */
 typedef uint8 keypad_returnDataType; /* Define the type of return from keypad */
 
+/*****************************************************************************/
+/** Description: This is to indicate the kind of a keypad event.            **/
+/**                                                                         **/
+/** Type: Enumeration.                                                      **/
+/**                                                                         **/
+/** Values: -  KEYPAD_EVENT_PRESS   => 0 -> The key became pressed.         **/
+/**         -  KEYPAD_EVENT_RELEASE => 1 -> The key became released.        **/
+/**         -  KEYPAD_EVENT_HOLD    => 2 -> The key is held for             **/
+/**                                        KEYPAD_HOLD_TICKS.               **/
+/**         -  KEYPAD_EVENT_REPEAT  => 3 -> The key is still held, every    **/
+/**                                        KEYPAD_REPEAT_TICKS after HOLD.  **/
+/*****************************************************************************/
+typedef enum{
+        KEYPAD_EVENT_PRESS  =0x00,
+        KEYPAD_EVENT_RELEASE=0x01,
+        KEYPAD_EVENT_HOLD   =0x02,
+        KEYPAD_EVENT_REPEAT =0x03
+}Keypad_EventKindType;
+
+/*****************************************************************************/
+/** Description: This is to hold one keypad event.                          **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - key   => Element of returnDataArray.                        **/
+/**           - kind  => Kind of the event.                                 **/
+/**           - time  => Keypad_update tick of the event.                   **/
+/*****************************************************************************/
+typedef struct{
+        keypad_returnDataType key;
+        Keypad_EventKindType  kind;
+        uint16                time;
+}Keypad_EventType;
+
 /*****************************************************************************/
 /** Description: This is to define all needed configurations for Keypad.    **/
 /**                                                                         **/
@@ -33,6 +90,31 @@ typedef uint8 keypad_returnDataType; /* Define the type of return from keypad */
 /**           - rowConfiguration  => The configurations of row pins.        **/
 /**           - colConfiguration  => The configurations of col pins         **/
 /**           - returnDataArray   => 2-D array to return data from keypad.  **/
+/**           - rowHandles        => Row pins, filled by Keypad_init.       **/
+/**           - colHandles        => Col pins, filled by Keypad_init.       **/
+/**           - keyChannels       => Debounce state of keys (pressed => 1). **/
+/**           - rowLatchAddress   => LATx of all rows, filled by            **/
+/**                                  Keypad_init (as all fields below).     **/
+/**           - rowLatchShadow    => RAM copy of LATx of the rows or        **/
+/**                                  NULL_PTR.                              **/
+/**           - rowsMask          => Row pins on their port.                **/
+/**           - rowSelect         => Row bits of LATx while a row is        **/
+/**                                  scanned (this row LOW, others HIGH).   **/
+/**           - colPortAddress    => PORTx of all cols.                     **/
+/**           - colsMask          => Col pins on their port.                **/
+/**           - colPinMasks       => Pin of every col.                      **/
+/**           - keyCodes          => returnDataArray by key index.          **/
+/**           - events            => Ring buffer of the events.             **/
+/**           - eventsHead        => Next slot, written by Keypad_update.   **/
+/**           - eventsTail        => Oldest event, written by               **/
+/**                                  Keypad_getEvent.                       **/
+/**           - eventsLost        => Events dropped with a full queue.      **/
+/**           - ticks             => Keypad_update calls (timestamps).      **/
+/**           - heldKey           => Index of the key for HOLD/REPEAT.      **/
+/**           - holdCount         => Ticks to the next HOLD/REPEAT.         **/
+/**           - holdKind          => HOLD or REPEAT at the next count end.  **/
+/**           - syncRequest       => Keypad_sync asked Keypad_update to     **/
+/**                                  restart the keys.                      **/
 /*****************************************************************************/
 typedef struct{
         uint8 rowsNumber;
@@ -40,12 +122,34 @@ typedef struct{
         HAL_GPIO_DeviceType   rowConfiguration[KEYPAD_MAX_ROW_NUMBER];
         HAL_GPIO_DeviceType   colConfiguration[KEYPAD_MAX_COL_NUMBER];
         keypad_returnDataType returnDataArray[KEYPAD_MAX_ROW_NUMBER][KEYPAD_MAX_COL_NUMBER];
+        HAL_GPIO_HandleType   rowHandles[KEYPAD_MAX_ROW_NUMBER];
+        HAL_GPIO_HandleType   colHandles[KEYPAD_MAX_COL_NUMBER];
+        Debounce_ChannelType  keyChannels[KEYPAD_DEBOUNCE_CHANNELS];
+        uint16                rowLatchAddress;
+        uint8 *               rowLatchShadow;
+        uint8                 rowsMask;
+        uint8                 rowSelect[KEYPAD_MAX_ROW_NUMBER];
+        uint16                colPortAddress;
+        uint8                 colsMask;
+        uint8                 colPinMasks[KEYPAD_MAX_COL_NUMBER];
+        keypad_returnDataType keyCodes[KEYPAD_MAX_KEYS_NUMBER];
+        Keypad_EventType      events[KEYPAD_EVENTS_NUMBER];
+        uint8                 eventsHead;
+        uint8                 eventsTail;
+        uint8                 eventsLost;
+        uint16                ticks;
+        uint8                 heldKey;
+        uint8                 holdCount;
+        Keypad_EventKindType  holdKind;
+        uint8                 syncRequest;
 }Keypad_ConfigType;
 
 /* Functions prototype */
 /**
   * @brief	By a call to Keypad_init The passed keypad will be initialized 
-  *			with filled configurations in passed pointer to struct. 
+  *			with filled configurations in passed pointer to struct. All rows 
+  *			must be on one port and all cols on one port, they are checked 
+  *			here only. 
   *	@param	Keypad_Configuration Pointer to Keypad_ConfigType which is 
   *			filled with needed configurations defined in Keypad_ConfigType 
   *			structure. 
@@ -54,8 +158,49 @@ typedef struct{
 Std_ErrorType Keypad_init(Keypad_ConfigType * Keypad_Configuration);
 
 /**
-  * @brief	By a call to Keypad_getReading The passed Keypad will be read and 
-  *			asigned in the passed buffer. 
+  * @brief	By a call to Keypad_sync The debounced keys restart at the keys 
+  *			held at the next Keypad_update, so a held key is not reported as 
+  *			a new press (after wake up for example). The queued events are 
+  *			dropped. 
+  *	@param	Keypad_Configuration Pointer to Keypad_ConfigType initialized 
+  *			by Keypad_init. 
+  *	@return	STD_OK if no Error and E_NOT_OK if there is Error.
+  */
+Std_ErrorType Keypad_sync(Keypad_ConfigType * Keypad_Configuration);
+
+/**
+  * @brief	By a call to Keypad_update The passed Keypad will be scanned once 
+  *			(one debounce sample) and its press, release, hold and repeat 
+  *			events queued. To be called every tick from the timer interrupt, 
+  *			each row costs one LATx write and one PORTx read. 
+  *	@param	Keypad_Configuration Pointer to Keypad_ConfigType initialized by 
+  *			Keypad_init.
+  */
+void Keypad_update(Keypad_ConfigType * Keypad_Configuration);
+
+/**
+  * @brief	By a call to Keypad_getEvent The oldest queued event is taken. 
+  *			To be called from main context only. 
+  *	@param[in]	Keypad_Configuration Pointer to Keypad_ConfigType initialized 
+  *				by Keypad_init.
+  *	@param[out]	Keypad_Event Pointer to Keypad_EventType to copy the event in.
+  *	@return	TRUE if an event was taken, FALSE if the queue is empty.
+  */
+uint8 Keypad_getEvent(Keypad_ConfigType * Keypad_Configuration,
+                      Keypad_EventType * Keypad_Event);
+
+/**
+  * @brief	By a call to Keypad_flush All queued events are dropped (keys 
+  *			pressed in a state which doesn't use the keypad). 
+  *	@param	Keypad_Configuration Pointer to Keypad_ConfigType initialized by 
+  *			Keypad_init.
+  */
+void Keypad_flush(Keypad_ConfigType * Keypad_Configuration);
+
+/**
+  * @brief	By a call to Keypad_getReading The next pressed or auto-repeated 
+  *			key is taken from the queue filled by Keypad_update, the other 
+  *			events before it are dropped. It never scans nor waits. 
   *	@param[in]	Keypad_Configuration Pointer to Keypad_ConfigType which is 
   *				filled with needed configurations defined in Keypad_ConfigType 
   *				structure. 
@@ -66,4 +211,15 @@ Std_ErrorType Keypad_init(Keypad_ConfigType * Keypad_Configuration);
   */
 Std_ErrorType Keypad_getReading(Keypad_ConfigType * Keypad_Configuration,
                                 keypad_returnDataType * keypad_returnData);
+
+/**
+  * @brief	By a call to Keypad_isIdle it is known if no key is held, moving 
+  *			or queued, then a key press can wake the controller 
+  *			through its column interrupt instead of a scan every tick. 
+  *	@param	Keypad_Configuration Pointer to Keypad_ConfigType initialized by 
+  *			Keypad_init.
+  *	@return	TRUE if the keypad is idle, FALSE otherwise.
+  */
+uint8 Keypad_isIdle(Keypad_ConfigType * Keypad_Configuration);
+
 #endif /* _MODULE_KEYPAD_H_ */
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*****************************************************************************/
+/** File:    Module_LcdBuffer.h                                             **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the LCD frame buffer, **/
+/**              the app writes a RAM copy of the 4x16 screen and only the  **/
+/**              changed characters are sent to the LCD by a flush.         **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _MODULE_LCDBUFFER_H_
+#define _MODULE_LCDBUFFER_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+#include "Module_Hd44780.h"
+
+/* Macros */
+#define LCDBUFFER_ROWS     HD44780_ROWS
+#define LCDBUFFER_COLUMNS  HD44780_COLUMNS  /* Up to 16, one dirty bit per column */
+
+/* Functions prototype */
+/**
+  * @brief	By a call to LcdBuffer_init The LCD output queue is started, the 
+  *			LCD is cleared and the buffer starts blank. To be called after 
+  *			Hd44780_init.
+  */
+void LcdBuffer_init(void);
+
+/**
+  * @brief	By a call to LcdBuffer_clear The LCD is cleared at once (one
+  *			command) and the buffer is blank with nothing to flush. With the
+  *			LCD queue full the cells are blanked and marked instead.
+  */
+void LcdBuffer_clear(void);
+
+/**
+  * @brief	By a call to LcdBuffer_chr One character is written to the buffer.
+  *	@param	Row Row of the LCD (1..LCDBUFFER_ROWS).
+  *	@param	Column Column of the LCD (1..LCDBUFFER_COLUMNS).
+  *	@param	Character The character.
+  *	@return	STD_OK if no Error and E_NOT_OK if the cell is out of the LCD.
+  */
+Std_ErrorType LcdBuffer_chr(uint8 Row, uint8 Column, char Character);
+
+/**
+  * @brief	By a call to LcdBuffer_out A text is written to the buffer, the
+  *			characters after the last column are dropped.
+  *	@param	Row Row of the LCD (1..LCDBUFFER_ROWS).
+  *	@param	Column Column of the first character (1..LCDBUFFER_COLUMNS).
+  *	@param	Text Null terminated text.
+  *	@return	STD_OK if no Error and E_NOT_OK if the cell is out of the LCD.
+  */
+Std_ErrorType LcdBuffer_out(uint8 Row, uint8 Column, char * Text);
+
+/**
+  * @brief	By a call to LcdBuffer_flush The changed characters are queued 
+  *			for the LCD, the address is only set where the cursor isn't 
+  *			already at the next changed character. To be called once per 
+  *			pass, it never waits for the LCD: the cells that don't fit in the
+  *			queue stay marked for the next flush.
+  */
+void LcdBuffer_flush(void);
+
+#endif /* _MODULE_LCDBUFFER_H_ */
@@ -0,0 +1,93 @@
+/*****************************************************************************/
+/** File:    Module_LcdQueue.h                                              **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the LCD output queue, **/
+/**              the main loop queues commands and characters and returns, **/
+/**              the Timer2 interrupt sends them at the LCD byte rate.      **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _MODULE_LCDQUEUE_H_
+#define _MODULE_LCDQUEUE_H_
+
+/* Inclusion */
+#include "HAL_InterruptHandler.h"
+#include "HAL_Timer2.h"
+#include "Module_Hd44780.h"
+
+/* Macros */
+/* Bytes waiting for the LCD, a power of 2 (one full screen is 72 bytes) */
+#ifndef LCDQUEUE_ENTRIES_NUMBER
+#define LCDQUEUE_ENTRIES_NUMBER  128
+#endif
+#if (LCDQUEUE_ENTRIES_NUMBER & (LCDQUEUE_ENTRIES_NUMBER-1)) || (LCDQUEUE_ENTRIES_NUMBER > 256)
+#error "LCDQUEUE_ENTRIES_NUMBER must be a power of 2 up to 256"
+#endif
+
+/* One byte every Timer2 period, longer than the execution of a HD44780   */
+/* byte. With the busy flag a shorter period reads it before every byte.  */
+#ifndef LCDQUEUE_PERIOD_US
+#define LCDQUEUE_PERIOD_US  100
+#endif
+#define LCDQUEUE_TCY_PER_US      2  /* Fosc = 8 MHz */
+#if (LCDQUEUE_PERIOD_US*LCDQUEUE_TCY_PER_US < 64) || (LCDQUEUE_PERIOD_US*LCDQUEUE_TCY_PER_US > 256)
+#error "LCDQUEUE_PERIOD_US must be 32..128 us (Timer2 without prescaler)"
+#endif
+#if !LCD_RW_WIRED && (LCDQUEUE_PERIOD_US < HD44780_EXECUTION_US)
+#error "Without the busy flag LCDQUEUE_PERIOD_US can't be shorter than a byte"
+#endif
+
+/* Periods skipped after clear display and return home (no busy flag) */
+#define LCDQUEUE_CLEAR_PERIODS   \
+((HD44780_CLEAR_US+LCDQUEUE_PERIOD_US-1)/LCDQUEUE_PERIOD_US)
+
+/* Functions prototype */
+/**
+  * @brief	By a call to LcdQueue_init The queue starts empty and Timer2 is
+  *			set to the LCD byte period, stopped until a byte is queued. The
+  *			LCD must be initialized before (Hd44780_init), then only the
+  *			queue writes the LCD.
+  */
+void LcdQueue_init(void);
+
+/**
+  * @brief	By a call to LcdQueue_cmd One command is queued, it never waits
+  *			for a free entry. To be called from main context.
+  *	@param	Command HD44780 command (HD44780_CLEAR, set DDRAM address, ...).
+  *	@return	STD_OK if queued and E_NOT_OK if the queue is full (dropped).
+  */
+Std_ErrorType LcdQueue_cmd(uint8 Command);
+
+/**
+  * @brief	By a call to LcdQueue_chr One character is queued, it never
+  *			waits for a free entry. To be called from main context.
+  *	@param	Character The character written at the LCD cursor.
+  *	@return	STD_OK if queued and E_NOT_OK if the queue is full (dropped).
+  */
+Std_ErrorType LcdQueue_chr(char Character);
+
+/**
+  * @brief	By a call to LcdQueue_update The oldest byte is sent to the LCD,
+  *			Timer2 is stopped when the queue is empty. LcdQueue_init sets it
+  *			as the Timer2 interrupt callback.
+  */
+void LcdQueue_update(void);
+
+/**
+  * @brief	By a call to LcdQueue_isEmpty it is known if all queued bytes
+  *			were sent.
+  *	@return	TRUE if the queue is empty, FALSE otherwise.
+  */
+uint8 LcdQueue_isEmpty(void);
+
+/**
+  * @brief	By a call to LcdQueue_getFree the free entries are known, so a
+  *			caller queues what fits and keeps the rest for later.
+  *	@return	The bytes that can be queued now.
+  */
+uint8 LcdQueue_getFree(void);
+
+#endif /* _MODULE_LCDQUEUE_H_ */
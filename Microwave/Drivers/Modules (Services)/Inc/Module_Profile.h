@@ -0,0 +1,196 @@
+/*****************************************************************************/
+/** File:    Module_Profile.h                                               **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the profiler, the     **/
+/**              probes timestamp named regions and the interrupt routine   **/
+/**              with Timer3 counting Tcy. With PROFILE_ENABLE FALSE        **/
+/**              (release) every probe expands to nothing.                  **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _MODULE_PROFILE_H_
+#define _MODULE_PROFILE_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+#include "HAL_Timer0.h"
+#include "Profile_Config.h"  /* Compile-time configuration */
+
+/* Macros */
+#define PROFILE_HISTOGRAM_LATENCY  0  /* Timer0 overflow to its callback */
+#define PROFILE_HISTOGRAM_ISR      1  /* Time in interrupt() (high) */
+#define PROFILE_HISTOGRAM_ISR_LOW  2  /* In interrupt_low(), high taken out */
+
+#if PROFILE_ENABLE
+/* Main context: Tcy of a region, the interrupts inside it are taken out, */
+/* the probes of a region nested inside are not.                         */
+#define PROFILE_INIT()          Profile_init()
+#define PROFILE_BEGIN(REGION)   Profile_begin(REGION)
+#define PROFILE_END(REGION)     Profile_end(REGION)
+/* High priority routine: Tcy of a region inside it, no routine nests   */
+#define PROFILE_ISR_BEGIN(REGION)  Profile_isrBegin(REGION)
+#define PROFILE_ISR_END(REGION)    Profile_isrEnd(REGION)
+/* Interrupt routines: first and last statements, then in the Timer0     */
+/* callback before HAL_Timer0_reload (TMR0 counts from the overflow)     */
+#define PROFILE_ISR_ENTRY()     Profile_isrEntry()
+#define PROFILE_ISR_EXIT()      Profile_isrExit()
+#define PROFILE_ISR_LOW_ENTRY() Profile_isrLowEntry()
+#define PROFILE_ISR_LOW_EXIT()  Profile_isrLowExit()
+#define PROFILE_TIMER0_LATENCY()  \
+        Profile_timer0Latency(HAL_Timer0_read()*HAL_Timer0_getPrescale())
+#else
+#define PROFILE_INIT()
+#define PROFILE_BEGIN(REGION)
+#define PROFILE_END(REGION)
+#define PROFILE_ISR_BEGIN(REGION)
+#define PROFILE_ISR_END(REGION)
+#define PROFILE_ISR_ENTRY()
+#define PROFILE_ISR_EXIT()
+#define PROFILE_ISR_LOW_ENTRY()
+#define PROFILE_ISR_LOW_EXIT()
+#define PROFILE_TIMER0_LATENCY()
+#endif /* PROFILE_ENABLE */
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is the statistics of one region or histogram, all in  **/
+/**              Tcy (0.5 us at 8 MHz), the probes cost is taken out.       **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - calls   => Number of measures (stops at 65535).             **/
+/**           - min     => Shortest measure.                                **/
+/**           - max     => Longest measure.                                 **/
+/**           - total   => Sum of the measures, total/calls is the mean.    **/
+/*****************************************************************************/
+typedef struct{
+        uint16 calls;
+        uint16 min;
+        uint16 max;
+        uint32 total;
+}Profile_StatsType;
+
+/*****************************************************************************/
+/** Description: This is a histogram with its statistics.                   **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - stats   => Statistics of all the measures.                  **/
+/**           - bins    => Measures of bin i are i*2^SHIFT..(i+1)*2^SHIFT-1 **/
+/**                        Tcy, the last bin counts the longer ones too.    **/
+/*****************************************************************************/
+typedef struct{
+        Profile_StatsType stats;
+        uint16            bins[PROFILE_BINS];
+}Profile_HistogramType;
+
+/* Functions prototype */
+/**
+  * @brief	By a call to Profile_init Timer3 counts Tcy free running and the
+  *			statistics are cleared, the cost of the probes is measured once.
+  *	@note	Timer3 wraps every 65536 Tcy (32.8 ms at 8 MHz), a region must
+  *			be shorter. The global interrupt is left enabled, as by
+  *			InterruptHandler_EnableInterrupt.
+  */
+void Profile_init(void);
+
+/**
+  * @brief	By a call to Profile_begin The region starts, main context only.
+  *	@param	Region One of the regions of Profile_Config.h.
+  */
+void Profile_begin(uint8 Region);
+
+/**
+  * @brief	By a call to Profile_end The region ends and its Tcy are added
+  *			to its statistics, the interrupt routine time in between and
+  *			the probes cost are taken out. Main context only.
+  *	@param	Region One of the regions of Profile_Config.h.
+  */
+void Profile_end(uint8 Region);
+
+/**
+  * @brief	By a call to Profile_isrBegin A region of the high priority
+  *			interrupt routine starts. Call it from that routine only.
+  *	@param	Region One of the regions of Profile_Config.h, not one of main.
+  */
+void Profile_isrBegin(uint8 Region);
+
+/**
+  * @brief	By a call to Profile_isrEnd The region of the high priority
+  *			interrupt routine ends and its Tcy, less one PROFILE_READ, are
+  *			added to its statistics. Call it from that routine only.
+  *	@param	Region One of the regions of Profile_Config.h, not one of main.
+  */
+void Profile_isrEnd(uint8 Region);
+
+/**
+  * @brief	By a call to Profile_isrEntry The interrupt routine starts.
+  *			Call it from the high priority interrupt routine only.
+  */
+void Profile_isrEntry(void);
+
+/**
+  * @brief	By a call to Profile_isrExit The time in the interrupt routine
+  *			is added to its histogram. Call it from the high priority
+  *			interrupt routine only.
+  *	@note	The vectoring and the context save/restore are not seen.
+  */
+void Profile_isrExit(void);
+
+/**
+  * @brief	By a call to Profile_isrLowEntry The low priority interrupt
+  *			routine starts. Call it from that routine only.
+  */
+void Profile_isrLowEntry(void);
+
+/**
+  * @brief	By a call to Profile_isrLowExit The time in the low priority
+  *			interrupt routine, less the high priority ones inside it, is
+  *			added to its histogram. Call it from that routine only.
+  */
+void Profile_isrLowExit(void);
+
+/**
+  * @brief	By a call to Profile_timer0Latency The latency of the Timer0
+  *			callback is added to its histogram. Call it from the interrupt
+  *			routine only.
+  *	@param	Cycles Tcy since the overflow, a multiple of the prescaler.
+  */
+void Profile_timer0Latency(uint16 Cycles);
+
+/**
+  * @brief	By a call to Profile_reset All statistics are cleared.
+  */
+void Profile_reset(void);
+
+/**
+  * @brief	By a call to Profile_getRegion A copy of the statistics of a
+  *			region is taken, for a debug screen.
+  *	@param	Region One of the regions of Profile_Config.h.
+  *	@param	Stats Pointer to the copy.
+  *	@return	STD_OK if no Error and E_NOT_OK if no region or NULL pointer.
+  */
+Std_ErrorType Profile_getRegion(uint8 Region, Profile_StatsType * Stats);
+
+/**
+  * @brief	By a call to Profile_getHistogram A copy of a histogram is
+  *			taken, for a debug screen.
+  *	@param	Histogram PROFILE_HISTOGRAM_LATENCY, PROFILE_HISTOGRAM_ISR or
+  *			PROFILE_HISTOGRAM_ISR_LOW.
+  *	@param	Copy Pointer to the copy.
+  *	@return	STD_OK if no Error and E_NOT_OK if no histogram or NULL pointer.
+  */
+Std_ErrorType Profile_getHistogram(uint8 Histogram, Profile_HistogramType * Copy);
+
+/**
+  * @brief	By a call to Profile_dump All statistics are written as text
+  *			lines, one character at a time, to a serial port for example.
+  *			Main context only.
+  *	@param	Put Function which sends one character.
+  */
+void Profile_dump(void (*Put)(char Character));
+
+#endif /* _MODULE_PROFILE_H_ */
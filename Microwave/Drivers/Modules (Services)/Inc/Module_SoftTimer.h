@@ -0,0 +1,95 @@
+/*****************************************************************************/
+/** File:    Module_SoftTimer.h                                             **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the software timers,  **/
+/**              one-shot and periodic timers counted in system ticks. The  **/
+/**              running timers are a delta list sorted by deadline, every  **/
+/**              tick decrements the head only.                             **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _MODULE_SOFTTIMER_H_
+#define _MODULE_SOFTTIMER_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is one software timer, it is owned by its user and    **/
+/**              linked in the running list while it runs.                  **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - next        => Next running timer (later or same deadline). **/
+/**           - delta       => Ticks after the deadline of the timer before **/
+/**                            it in the list (after now for the head).     **/
+/**           - period      => Ticks to restart with, 0 => one-shot.        **/
+/**           - running     => TRUE while linked in the list.               **/
+/**           - expirations => Expirations not taken by SoftTimer_expired.  **/
+/*****************************************************************************/
+typedef struct SoftTimer_Struct{
+        struct SoftTimer_Struct * next;
+        uint16 delta;
+        uint16 period;
+        uint8  running;
+        uint8  expirations;
+}SoftTimer_Type;
+
+/* Functions prototype */
+/**
+  * @brief	By a call to SoftTimer_start The timer expires Ticks ticks from
+  *			now, then every Period ticks (Period 0 => one time). A running
+  *			timer is restarted and its expirations are dropped.
+  *	@param	Timer Pointer to SoftTimer_Type.
+  *	@param	Ticks Ticks to the first expiration (1..65535).
+  *	@param	Period Ticks between the next expirations, 0 => one-shot.
+  *	@return	STD_OK if no Error and E_NOT_OK if Ticks is 0 or no timer.
+  */
+Std_ErrorType SoftTimer_start(SoftTimer_Type * Timer, uint16 Ticks, uint16 Period);
+
+/**
+  * @brief	By a call to SoftTimer_stop The timer leaves the running list and
+  *			its expirations are dropped.
+  *	@param	Timer Pointer to SoftTimer_Type.
+  */
+void SoftTimer_stop(SoftTimer_Type * Timer);
+
+/**
+  * @brief	By a call to SoftTimer_expired One expiration of the timer is
+  *			taken, to be called from main context once per pass.
+  *	@param	Timer Pointer to SoftTimer_Type.
+  *	@return	TRUE once per expiration, FALSE if none is left.
+  */
+uint8 SoftTimer_expired(SoftTimer_Type * Timer);
+
+/**
+  * @brief	By a call to SoftTimer_remaining The ticks left to the next
+  *			expiration are known.
+  *	@param	Timer Pointer to SoftTimer_Type.
+  *	@return	Ticks to the next expiration, 0 if the timer is stopped.
+  */
+uint16 SoftTimer_remaining(SoftTimer_Type * Timer);
+
+/**
+  * @brief	By a call to SoftTimer_nextDeadline The ticks to the first
+  *			expiration of all running timers are known, a tickless idle
+  *			doesn't sleep past it. Call it with interrupts disabled.
+  *	@return	Ticks to the next expiration, 0 if no timer runs.
+  */
+uint16 SoftTimer_nextDeadline(void);
+
+/**
+  * @brief	By a call to SoftTimer_advance Ticks ticks pass, the head of the
+  *			list is decremented and the timers at their deadline expire
+  *			(periodic ones are linked again). Call it from the tick
+  *			interrupt only.
+  *	@param	Ticks Ticks since the last call, the length of the period which
+  *			just ended.
+  */
+void SoftTimer_advance(uint8 Ticks);
+
+#endif /* _MODULE_SOFTTIMER_H_ */
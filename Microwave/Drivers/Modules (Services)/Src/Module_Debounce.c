@@ -0,0 +1,181 @@
+/*****************************************************************************/
+/** File:    Module_Debounce.c                                              **/
+/**                                                                         **/
+/** Description: This file is the implementation of the debouncer.          **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "Module_Debounce.h"
+#include "HAL_InterruptHandler.h"
+
+/* Global variables */
+Debounce_ChannelType Debounce_Ports[GPIO_NUMBER_OF_PORTS];
+uint8 Debounce_PortsFell[GPIO_NUMBER_OF_PORTS];
+uint8 Debounce_PortsRose[GPIO_NUMBER_OF_PORTS];
+
+/* Local variables */
+static uint8 Debounce_PortsMask=0;  /* Ports sampled by Debounce_update */
+
+/* Public functions defination */
+/*****************************************************************************/
+/** Description: By a call to Debounce_channelInit The passed channel will  **/
+/**              start stable at the passed levels, counters are reset and  **/
+/**              pending edges are dropped.                                 **/
+/**                                                                         **/
+/** Parameters: + Debounce_Channel => Pointer to Debounce_ChannelType.      **/
+/**             + Levels => The current levels of the 8 inputs.             **/
+/*****************************************************************************/
+void Debounce_channelInit(Debounce_ChannelType * Debounce_Channel, uint8 Levels)
+{
+      Debounce_Channel->stable=Levels;
+      Debounce_Channel->count0=DEBOUNCE_RESET_COUNT0;
+      Debounce_Channel->count1=DEBOUNCE_RESET_COUNT1;
+      Debounce_Channel->fell=0;
+      Debounce_Channel->rose=0;
+}
+
+/*****************************************************************************/
+/** Description: By a call to Debounce_channelSample One sample is counted  **/
+/**              for the 8 inputs together. Every input has a 2 bits        **/
+/**              counter (bit 0 in count0, bit 1 in count1) which is reset  **/
+/**              to DEBOUNCE_SAMPLES-1 while the sample equals the stable   **/
+/**              level and counts down while it differs, the stable level   **/
+/**              changes on the sample which finds the counter at 0.        **/
+/**                                                                         **/
+/** Parameters: + Debounce_Channel => Pointer to Debounce_ChannelType.      **/
+/**             + Sample => The sampled levels of the 8 inputs.             **/
+/*****************************************************************************/
+void Debounce_channelSample(Debounce_ChannelType * Debounce_Channel, uint8 Sample)
+{
+      uint8 _Delta;    /* Inputs which differ from stable */
+      uint8 _Changed;  /* Inputs which become stable at the new level */
+      uint8 _Count;    /* Inputs which keep counting down */
+
+      _Delta   = Sample ^ Debounce_Channel->stable;
+      _Changed = _Delta & ~(Debounce_Channel->count0) & ~(Debounce_Channel->count1);
+      _Count   = _Delta & ~_Changed;
+      /* Decrement where _Count is set, reset the other counters */
+      Debounce_Channel->count1 = (_Count & (Debounce_Channel->count1 ^ ~(Debounce_Channel->count0))) |
+                                 (~_Count & DEBOUNCE_RESET_COUNT1);
+      Debounce_Channel->count0 = (_Count & ~(Debounce_Channel->count0)) |
+                                 (~_Count & DEBOUNCE_RESET_COUNT0);
+
+      Debounce_Channel->stable ^= _Changed;
+      Debounce_Channel->rose   |= _Changed & Debounce_Channel->stable;
+      Debounce_Channel->fell   |= _Changed & ~(Debounce_Channel->stable);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Debounce_init The passed ports will be        **/
+/**              sampled by Debounce_update, they start stable at their     **/
+/**              current levels. The pins must be initialized as inputs.    **/
+/**                                                                         **/
+/** Parameters: + PortsMask => GPIO_PORT_MASK of the debounced ports.       **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the ports are debounced.     **/
+/**                           - E_NOT_OK: If the mask has no port or a      **/
+/**                                       wrong port.                       **/
+/*****************************************************************************/
+Std_ErrorType Debounce_init(uint8 PortsMask)
+{
+      if(PortsMask == 0 || (PortsMask & ~GPIO_ALL_PORTS_MASK))
+      return STD_ERROR;   /* Wrong ports */
+
+      Debounce_PortsMask=PortsMask;
+      Debounce_reset();
+
+      return STD_OK;  /* No Error */
+}
+
+/*****************************************************************************/
+/** Description: By a call to Debounce_reset The debounced ports restart    **/
+/**              stable at their current levels with no pending edges, so a **/
+/**              change while the ticks were stopped is not an edge.        **/
+/**              Interrupts are disabled while the counters are written,    **/
+/**              the tick may be running.                                   **/
+/*****************************************************************************/
+void Debounce_reset(void)
+{
+      uint8 _Port;  /* Index of port */
+
+      InterruptHandler_DisableGlobalInterrupt();
+      for(_Port=0; _Port<GPIO_NUMBER_OF_PORTS; _Port++)
+      {
+            if(Debounce_PortsMask & (1<<_Port))
+            {
+                  Debounce_channelInit(&Debounce_Ports[_Port],
+                                       HAL_RegisterRead(PORTA_BASE_ADDRESS+_Port));
+            }
+            Debounce_PortsFell[_Port]=0;
+            Debounce_PortsRose[_Port]=0;
+      }
+      InterruptHandler_EnbleGlobalInterrupt();
+}
+
+/*****************************************************************************/
+/** Description: By a call to Debounce_update Every debounced port is read  **/
+/**              once and sampled, it never waits. It is called every tick  **/
+/**              by the timer interrupt.                                    **/
+/*****************************************************************************/
+void Debounce_update(void)
+{
+      uint8 _Port;  /* Index of port */
+
+      for(_Port=0; _Port<GPIO_NUMBER_OF_PORTS; _Port++)
+      {
+            if(Debounce_PortsMask & (1<<_Port))
+            {
+                  Debounce_channelSample(&Debounce_Ports[_Port],
+                                         HAL_RegisterRead(PORTA_BASE_ADDRESS+_Port));
+            }
+      }
+}
+
+/*****************************************************************************/
+/** Description: By a call to Debounce_takeEvents The pending edges of all  **/
+/**              debounced ports are moved to Debounce_PortsFell and        **/
+/**              Debounce_PortsRose for this pass and cleared, interrupts   **/
+/**              are disabled while they are moved.                         **/
+/*****************************************************************************/
+void Debounce_takeEvents(void)
+{
+      uint8 _Port;  /* Index of port */
+
+      InterruptHandler_DisableGlobalInterrupt();
+      for(_Port=0; _Port<GPIO_NUMBER_OF_PORTS; _Port++)
+      {
+            Debounce_PortsFell[_Port]=Debounce_Ports[_Port].fell;
+            Debounce_PortsRose[_Port]=Debounce_Ports[_Port].rose;
+            Debounce_Ports[_Port].fell=0;
+            Debounce_Ports[_Port].rose=0;
+      }
+      InterruptHandler_EnbleGlobalInterrupt();
+}
+
+/*****************************************************************************/
+/** Description: By a call to Debounce_isSettled It is known if all the     **/
+/**              debounced inputs equal their stable levels, which is when  **/
+/**              every counter is back at its reset value.                  **/
+/**                                                                         **/
+/** Return: uint8 => - TRUE:  No input is moving.                           **/
+/**                  - FALSE: An input is counting to a new level.          **/
+/*****************************************************************************/
+uint8 Debounce_isSettled(void)
+{
+      uint8 _Port;  /* Index of port */
+
+      for(_Port=0; _Port<GPIO_NUMBER_OF_PORTS; _Port++)
+      {
+            if((Debounce_PortsMask & (1<<_Port)) &&
+               (Debounce_Ports[_Port].count0 != DEBOUNCE_RESET_COUNT0 ||
+                Debounce_Ports[_Port].count1 != DEBOUNCE_RESET_COUNT1))
+            {
+                  return FALSE;
+            }
+      }
+      return TRUE;
+}
@@ -0,0 +1,88 @@
+/*****************************************************************************/
+/** File:    Module_Hd44780.c                                               **/
+/**                                                                         **/
+/** Description: This file is the implementation of the HD44780 LCD driver. **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "Module_Hd44780.h"
+
+/* Local macros */
+#define HD44780_POWER_ON_MS     15    /* Vcc up to the first instruction */
+#define HD44780_RESET1_US       4100  /* After the first function set */
+#define HD44780_RESET2_US       100   /* After the second one */
+#define HD44780_8BITS_NIBBLE    0x03  /* Function set, 8 bits bus */
+#define HD44780_4BITS_NIBBLE    0x02  /* Function set, 4 bits bus */
+
+/* Private functions prototype */
+static void Hd44780_waitReady(uint8 Long);
+static void Hd44780_cmd(uint8 Command);
+
+/* Private functions defination */
+/* Wait for the end of the instruction: busy flag, or the execution time */
+/* (Long => clear display and return home)                               */
+static void Hd44780_waitReady(uint8 Long)
+{
+#if LCD_RW_WIRED
+      uint8 _Busy;
+
+      (void)Long;
+      do
+      {
+            HD44780_READ_BUSY(_Busy);
+      }while(_Busy);
+#else
+      if(Long)    Delay_us(HD44780_CLEAR_US);
+      else        Delay_us(HD44780_EXECUTION_US);
+#endif
+}
+
+/* Send one command and wait for its end */
+static void Hd44780_cmd(uint8 Command)
+{
+      HD44780_WRITE_BYTE(0,Command);
+      Hd44780_waitReady(Command == HD44780_CLEAR || Command == HD44780_RETURN_HOME);
+}
+
+/* Public functions defination */
+/*****************************************************************************/
+/** Description: By a call to Hd44780_init The LCD pins are outputs and the **/
+/**              LCD is reset by instruction: 3 times the 8 bits function   **/
+/**              set (one nibble each, fixed waits), then the 4 bits one.   **/
+/**              After it the LCD is cleared and turned on without cursor.  **/
+/*****************************************************************************/
+void Hd44780_init(void)
+{
+      GPIO_PIN_CLEAR(LCD_RS_PIN);
+      GPIO_PIN_CLEAR(LCD_EN_PIN);
+      HAL_RegisterClearMask(HD44780_DATA_LATCH,HD44780_DATA_MASK);
+      HAL_RegisterClearBit(HD44780_PORT_OF(LCD_RS_PIN)+PORT_DIRECTION_OFFSET,HD44780_PIN_OF(LCD_RS_PIN));
+      HAL_RegisterClearBit(HD44780_PORT_OF(LCD_EN_PIN)+PORT_DIRECTION_OFFSET,HD44780_PIN_OF(LCD_EN_PIN));
+      HAL_RegisterClearMask(HD44780_DATA_DIRECTION,HD44780_DATA_MASK);
+#if LCD_RW_WIRED
+      GPIO_PIN_CLEAR(LCD_RW_PIN); /* Write */
+      HAL_RegisterClearBit(HD44780_PORT_OF(LCD_RW_PIN)+PORT_DIRECTION_OFFSET,HD44780_PIN_OF(LCD_RW_PIN));
+#endif
+
+      Delay_ms(HD44780_POWER_ON_MS);
+      HD44780_WRITE_NIBBLE(HD44780_8BITS_NIBBLE);
+      HD44780_PULSE_ENABLE();
+      Delay_us(HD44780_RESET1_US);
+      HD44780_PULSE_ENABLE();
+      Delay_us(HD44780_RESET2_US);
+      HD44780_PULSE_ENABLE();
+      Delay_us(HD44780_EXECUTION_US);
+      HD44780_WRITE_NIBBLE(HD44780_4BITS_NIBBLE);
+      HD44780_PULSE_ENABLE();
+      Hd44780_waitReady(FALSE); /* The busy flag is valid from here */
+
+      Hd44780_cmd(HD44780_FUNCTION_SET);
+      Hd44780_cmd(HD44780_DISPLAY_OFF);
+      Hd44780_cmd(HD44780_CLEAR);
+      Hd44780_cmd(HD44780_ENTRY_MODE);
+      Hd44780_cmd(HD44780_DISPLAY_ON);
+}
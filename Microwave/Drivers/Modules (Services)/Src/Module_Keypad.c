@@ -13,19 +13,91 @@
 
 /* Private functions prototype */
 static Std_ErrorType Keypad_checkForError(Keypad_ConfigType * Keypad_Configuration);
+static void Keypad_scanKeys(Keypad_ConfigType * Keypad_Configuration, uint8 * Keys);
+static void Keypad_putEvent(Keypad_ConfigType * Keypad_Configuration, uint8 Key,
+                            Keypad_EventKindType Kind);
 
 /* Private functions defination */
 static Std_ErrorType Keypad_checkForError(Keypad_ConfigType * Keypad_Configuration)
 {
-       if(Keypad_Configuration->rowsNumber <= 0)                return STD_ERROR;
-       if(Keypad_Configuration->colsNumber <= 0)                return STD_ERROR;
-       if(Keypad_Configuration->rowConfiguration == (HAL_GPIO_DeviceType *) NULL_PTR)      return STD_ERROR;
-       if(Keypad_Configuration->colConfiguration == (HAL_GPIO_DeviceType *) NULL_PTR)      return STD_ERROR;
-       if(Keypad_Configuration->returnDataArray == (keypad_returnDataType*) NULL_PTR)      return STD_ERROR;
+       if(Keypad_Configuration == (Keypad_ConfigType *) NULL_PTR)   return STD_ERROR;
+       if(Keypad_Configuration->rowsNumber == 0 ||
+          Keypad_Configuration->rowsNumber > KEYPAD_MAX_ROW_NUMBER)  return STD_ERROR;
+       if(Keypad_Configuration->colsNumber == 0 ||
+          Keypad_Configuration->colsNumber > KEYPAD_MAX_COL_NUMBER)  return STD_ERROR;
        
        return STD_OK;
 }
 
+/* Scan the matrix once, the bit of every pressed key is set in Keys */
+static void Keypad_scanKeys(Keypad_ConfigType * Keypad_Configuration, uint8 * Keys)
+{
+      uint8 _Row;
+      uint8 _Col;
+      uint8 _Key=0;     /* Index of first key of the row */
+      uint8 _Latch;     /* LATx of the rows without the row bits */
+      uint8 _Pressed;   /* Col pins pulled LOW by a key */
+
+      for(_Row=0; _Row<KEYPAD_DEBOUNCE_CHANNELS; _Row++)
+      {
+            Keys[_Row]=0;
+      }
+      if(Keypad_Configuration->rowLatchShadow != NULL_PTR)
+      {
+            _Latch=*(Keypad_Configuration->rowLatchShadow);
+      }
+      else
+      {
+            _Latch=HAL_RegisterRead(Keypad_Configuration->rowLatchAddress);
+      }
+      _Latch &=~ (Keypad_Configuration->rowsMask);
+
+      for(_Row=0; _Row < (Keypad_Configuration->rowsNumber); _Row++)
+      {
+            /* One write: this row LOW, the other rows HIGH */
+            HAL_RegisterWrite(Keypad_Configuration->rowLatchAddress,
+                              _Latch | Keypad_Configuration->rowSelect[_Row]);
+            /* One read of all cols */
+            _Pressed=~HAL_RegisterRead(Keypad_Configuration->colPortAddress) &
+                     Keypad_Configuration->colsMask;
+            if(_Pressed != 0)
+            {
+                  for(_Col=0; _Col < (Keypad_Configuration->colsNumber); _Col++)
+                  {
+                        if(_Pressed & Keypad_Configuration->colPinMasks[_Col])
+                        {
+                              Keys[(_Key+_Col)>>3] |= (1<<((_Key+_Col)&0x07));
+                        }
+                  }
+            }
+            _Key+=Keypad_Configuration->colsNumber;
+      }
+      /* Leave all rows LOW so any key pulls its column down (wake up) */
+      HAL_RegisterWrite(Keypad_Configuration->rowLatchAddress,_Latch);
+      if(Keypad_Configuration->rowLatchShadow != NULL_PTR)
+      {
+            *(Keypad_Configuration->rowLatchShadow)=_Latch;
+      }
+}
+
+/* Queue one event, interrupt context only (the only writer of eventsHead) */
+static void Keypad_putEvent(Keypad_ConfigType * Keypad_Configuration, uint8 Key,
+                            Keypad_EventKindType Kind)
+{
+      uint8 _Head=Keypad_Configuration->eventsHead;
+      uint8 _Next=(_Head+1) & (KEYPAD_EVENTS_NUMBER-1);
+
+      if(_Next == Keypad_Configuration->eventsTail) /* Queue full */
+      {
+            Keypad_Configuration->eventsLost++;
+            return;
+      }
+      Keypad_Configuration->events[_Head].key =Keypad_Configuration->keyCodes[Key];
+      Keypad_Configuration->events[_Head].kind=Kind;
+      Keypad_Configuration->events[_Head].time=Keypad_Configuration->ticks;
+      Keypad_Configuration->eventsHead=_Next;  /* Publish the event */
+}
+
 /* Public functions defination */
 /*****************************************************************************/
 /** Description: By a call to Keypad_init The passed keypad will be         **/
@@ -48,6 +120,8 @@ Std_ErrorType Keypad_init(Keypad_ConfigType * Keypad_Configuration)
       Std_ErrorType _Function_Return;
       uint8 _Loop_Variable;
       uint8 _Loop_Variable_Max;
+      uint8 _Loop_Variable_Branch;
+      uint8 _Key=0;   /* Index of key */
       
       /* Check parameters */
       _Function_Return= Keypad_checkForError(Keypad_Configuration);
@@ -68,23 +142,205 @@ Std_ErrorType Keypad_init(Keypad_ConfigType * Keypad_Configuration)
              if(_Loop_Variable < Keypad_Configuration->colsNumber)
              {
                    Keypad_Configuration->colConfiguration[_Loop_Variable].deviceDirection=INPUT;
-                   _Function_Return=GPIO_DeviceInit(&Keypad_Configuration->colConfiguration[_Loop_Variable]);
+                   _Function_Return=GPIO_DeviceInitHandle(&Keypad_Configuration->colConfiguration[_Loop_Variable],
+                                                          &Keypad_Configuration->colHandles[_Loop_Variable]);
                    if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
              }
              if(_Loop_Variable < Keypad_Configuration->rowsNumber)
              {
                    Keypad_Configuration->rowConfiguration[_Loop_Variable].deviceDirection=OUTPUT;
-                   _Function_Return=GPIO_DeviceInit(&Keypad_Configuration->rowConfiguration[_Loop_Variable]);
+                   _Function_Return=GPIO_DeviceInitHandle(&Keypad_Configuration->rowConfiguration[_Loop_Variable],
+                                                          &Keypad_Configuration->rowHandles[_Loop_Variable]);
                    if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
              }
       }
-      
+
+      /* One port for all rows and one for all cols, then precompute the scan */
+      Keypad_Configuration->rowLatchAddress=Keypad_Configuration->rowHandles[0].latchAddress;
+      Keypad_Configuration->rowLatchShadow =Keypad_Configuration->rowHandles[0].latchShadow;
+      Keypad_Configuration->colPortAddress =Keypad_Configuration->colHandles[0].portAddress;
+      Keypad_Configuration->rowsMask=0;
+      Keypad_Configuration->colsMask=0;
+      for(_Loop_Variable=0; _Loop_Variable < (Keypad_Configuration->rowsNumber); _Loop_Variable++)
+      {
+            if(Keypad_Configuration->rowHandles[_Loop_Variable].latchAddress !=
+               Keypad_Configuration->rowLatchAddress)        return STD_ERROR; /* Rows on 2 ports */
+            Keypad_Configuration->rowsMask |= Keypad_Configuration->rowHandles[_Loop_Variable].pinMask;
+      }
+      for(_Loop_Variable=0; _Loop_Variable < (Keypad_Configuration->colsNumber); _Loop_Variable++)
+      {
+            if(Keypad_Configuration->colHandles[_Loop_Variable].portAddress !=
+               Keypad_Configuration->colPortAddress)         return STD_ERROR; /* Cols on 2 ports */
+            Keypad_Configuration->colPinMasks[_Loop_Variable]=Keypad_Configuration->colHandles[_Loop_Variable].pinMask;
+            Keypad_Configuration->colsMask |= Keypad_Configuration->colPinMasks[_Loop_Variable];
+      }
+      for(_Loop_Variable=0; _Loop_Variable < (Keypad_Configuration->rowsNumber); _Loop_Variable++)
+      {
+            Keypad_Configuration->rowSelect[_Loop_Variable]=Keypad_Configuration->rowsMask &
+                                                           ~(Keypad_Configuration->rowHandles[_Loop_Variable].pinMask);
+            for(_Loop_Variable_Branch=0; _Loop_Variable_Branch < (Keypad_Configuration->colsNumber); _Loop_Variable_Branch++)
+            {
+                  Keypad_Configuration->keyCodes[_Key++]=
+                       Keypad_Configuration->returnDataArray[_Loop_Variable][_Loop_Variable_Branch];
+            }
+      }
+
+      /* Empty queue, the keys restart at the first Keypad_update */
+      Keypad_Configuration->eventsHead=0;
+      Keypad_Configuration->eventsTail=0;
+      Keypad_Configuration->eventsLost=0;
+      Keypad_Configuration->ticks=0;
+      Keypad_Configuration->heldKey=KEYPAD_NO_KEY;
+
+      return Keypad_sync(Keypad_Configuration);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Keypad_sync The debounced keys of the passed **/
+/**              keypad restart at the keys held at the next Keypad_update  **/
+/**              with no pending press, the queued events are dropped.      **/
+/**                                                                         **/
+/** Parameters: + Keypad_Configuration => Pointer to Keypad_ConfigType      **/
+/**                                       initialized by Keypad_init.       **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When all configurations filled    **/
+/**                                       with correct data.                **/
+/**                           - E_NOT_OK: If there is data filled with      **/
+/**                                       wrong data (out of range for      **/
+/**                                       example) or pass NULL pointer.    **/
+/**                                                                         **/
+/** Note: The scan is left to Keypad_update so the matrix is only driven    **/
+/**       from the timer interrupt.                                         **/
+/*****************************************************************************/
+Std_ErrorType Keypad_sync(Keypad_ConfigType * Keypad_Configuration)
+{
+      /* Parameters are checked once by Keypad_init */
+      Keypad_Configuration->syncRequest=TRUE;
+      Keypad_flush(Keypad_Configuration);
+
       return STD_OK; /* If the code reaches this point then NO ERROR happened */
 }
 
 /*****************************************************************************/
-/** Description: By a call to Keypad_getReading The passed Keypad will be   **/
-/**              read and asigned in the passed buffer.                     **/
+/** Description: By a call to Keypad_update The passed Keypad will be       **/
+/**              scanned once (one debounce sample, no waiting) and its     **/
+/**              events queued: press and release of every key, then hold   **/
+/**              and repeat of the last pressed key while it is held. It is **/
+/**              called every tick by the timer interrupt.                  **/
+/**                                                                         **/
+/** Parameters: + Keypad_Configuration => Pointer to Keypad_ConfigType      **/
+/**                                       initialized by Keypad_init.       **/
+/*****************************************************************************/
+void Keypad_update(Keypad_ConfigType * Keypad_Configuration)
+{
+      uint8 _Keys[KEYPAD_DEBOUNCE_CHANNELS];
+      uint8 _Channel;
+      uint8 _Key;     /* Index of key */
+      uint8 _Bit;
+      Debounce_ChannelType * _Keys_Channel;
+
+      Keypad_Configuration->ticks++;
+      Keypad_scanKeys(Keypad_Configuration,_Keys);
+      if(Keypad_Configuration->syncRequest == TRUE)
+      {
+            /* Held keys are stable, not pressed (Debounce_channelInit is main context) */
+            for(_Channel=0; _Channel<KEYPAD_DEBOUNCE_CHANNELS; _Channel++)
+            {
+                  _Keys_Channel=&(Keypad_Configuration->keyChannels[_Channel]);
+                  _Keys_Channel->stable=_Keys[_Channel];
+                  _Keys_Channel->count0=DEBOUNCE_RESET_COUNT0;
+                  _Keys_Channel->count1=DEBOUNCE_RESET_COUNT1;
+                  _Keys_Channel->fell=0;
+                  _Keys_Channel->rose=0;
+            }
+            Keypad_Configuration->heldKey=KEYPAD_NO_KEY;
+            Keypad_Configuration->syncRequest=FALSE;
+            return;
+      }
+
+      for(_Channel=0; _Channel<KEYPAD_DEBOUNCE_CHANNELS; _Channel++)
+      {
+            _Keys_Channel=&(Keypad_Configuration->keyChannels[_Channel]);
+            Debounce_channelSample(_Keys_Channel,_Keys[_Channel]);
+            if((_Keys_Channel->rose | _Keys_Channel->fell) == 0) continue;
+            /* Queue the edges in key order */
+            _Key=_Channel<<3;
+            for(_Bit=0x01; _Bit != 0; _Bit <<= 1)
+            {
+                  if(_Keys_Channel->fell & _Bit)
+                  {
+                        Keypad_putEvent(Keypad_Configuration,_Key,KEYPAD_EVENT_RELEASE);
+                        if(_Key == Keypad_Configuration->heldKey)
+                              Keypad_Configuration->heldKey=KEYPAD_NO_KEY;
+                  }
+                  if(_Keys_Channel->rose & _Bit)
+                  {
+                        Keypad_putEvent(Keypad_Configuration,_Key,KEYPAD_EVENT_PRESS);
+                        Keypad_Configuration->heldKey=_Key;   /* The last press holds */
+                        Keypad_Configuration->holdCount=KEYPAD_HOLD_TICKS;
+                        Keypad_Configuration->holdKind=KEYPAD_EVENT_HOLD;
+                  }
+                  _Key++;
+            }
+            _Keys_Channel->rose=0;
+            _Keys_Channel->fell=0;
+      }
+
+      if(Keypad_Configuration->heldKey != KEYPAD_NO_KEY)
+      {
+            Keypad_Configuration->holdCount--;
+            if(Keypad_Configuration->holdCount == 0)
+            {
+                  Keypad_putEvent(Keypad_Configuration,Keypad_Configuration->heldKey,
+                                  Keypad_Configuration->holdKind);
+                  Keypad_Configuration->holdCount=KEYPAD_REPEAT_TICKS;
+                  Keypad_Configuration->holdKind=KEYPAD_EVENT_REPEAT;
+            }
+      }
+}
+
+/*****************************************************************************/
+/** Description: By a call to Keypad_getEvent The oldest queued event of    **/
+/**              the passed keypad is copied and removed, main context only **/
+/**              (the only writer of eventsTail).                           **/
+/**                                                                         **/
+/** Parameters: + Keypad_Configuration => Pointer to Keypad_ConfigType      **/
+/**                                       initialized by Keypad_init.       **/
+/**             + Keypad_Event => Pointer to Keypad_EventType to copy the   **/
+/**                               event in.                                 **/
+/**                                                                         **/
+/** Return: uint8 => - TRUE:  An event was taken.                           **/
+/**                  - FALSE: The queue is empty.                           **/
+/*****************************************************************************/
+uint8 Keypad_getEvent(Keypad_ConfigType * Keypad_Configuration,
+                      Keypad_EventType * Keypad_Event)
+{
+      uint8 _Tail=Keypad_Configuration->eventsTail;
+
+      if(_Tail == Keypad_Configuration->eventsHead)       return FALSE; /* Empty */
+
+      * Keypad_Event=Keypad_Configuration->events[_Tail];
+      Keypad_Configuration->eventsTail=(_Tail+1) & (KEYPAD_EVENTS_NUMBER-1);
+      return TRUE;
+}
+
+/*****************************************************************************/
+/** Description: By a call to Keypad_flush All queued events of the passed  **/
+/**              keypad are dropped, main context only.                     **/
+/**                                                                         **/
+/** Parameters: + Keypad_Configuration => Pointer to Keypad_ConfigType      **/
+/**                                       initialized by Keypad_init.       **/
+/*****************************************************************************/
+void Keypad_flush(Keypad_ConfigType * Keypad_Configuration)
+{
+      Keypad_Configuration->eventsTail=Keypad_Configuration->eventsHead;
+}
+
+/*****************************************************************************/
+/** Description: By a call to Keypad_getReading The next pressed or         **/
+/**              auto-repeated key of the passed keypad is taken from the   **/
+/**              queue filled by Keypad_update, the release and hold events **/
+/**              before it are dropped. It never scans nor waits.           **/
 /**                                                                         **/
 /** Parameters: + Keypad_Configuration => Pointer to Keypad_ConfigType      **/
 /**                                       which is filled with needed       **/
@@ -106,48 +362,53 @@ Std_ErrorType Keypad_init(Keypad_ConfigType * Keypad_Configuration)
 Std_ErrorType Keypad_getReading(Keypad_ConfigType * Keypad_Configuration,
                                 keypad_returnDataType * keypad_returnData)
 {
-      Std_ErrorType _Function_Return;
-      HAL_GPIO_StatusType _Pins_Reading;
-      uint8 _Loop_Variable_Main;
-      uint8 _Loop_Variable_Branch;
-      
-      /* Check parameters */
-      _Function_Return= Keypad_checkForError(Keypad_Configuration);
-      if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
-      
-      /* Get reading process */
-      for(_Loop_Variable_Main=0; _Loop_Variable_Main < (Keypad_Configuration->rowsNumber); _Loop_Variable_Main++)
+      Keypad_EventType _Event;
+
+      /* Parameters are checked once by Keypad_init */
+      while(Keypad_getEvent(Keypad_Configuration,&_Event) == TRUE)
       {
-            for(_Loop_Variable_Branch=0; _Loop_Variable_Branch < (Keypad_Configuration->rowsNumber); _Loop_Variable_Branch++)
-            {
-                    _Function_Return=GPIO_DeviceSet(&(Keypad_Configuration->rowConfiguration[_Loop_Variable_Branch]));
-                    if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
-            } /* Set all ROW pins */
-            /* Clear only one pin */
-            _Function_Return=GPIO_DeviceClear(&(Keypad_Configuration->rowConfiguration[_Loop_Variable_Main]));
-            if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
-            
-            for(_Loop_Variable_Branch=0; _Loop_Variable_Branch < (Keypad_Configuration->colsNumber); _Loop_Variable_Branch++)
+            if(_Event.kind == KEYPAD_EVENT_PRESS || _Event.kind == KEYPAD_EVENT_REPEAT)
             {
-                    _Function_Return=GPIO_DeviceGetRead(&(Keypad_Configuration->colConfiguration[_Loop_Variable_Branch]),
-                                                        &_Pins_Reading);
-                    if(_Function_Return == STD_ERROR)       return STD_ERROR; /* Error in struct */
-                    
-                    if(_Pins_Reading == LOW) /* key is pressed */
-                    {
-                         /* Debouncing */
-                         HAL_GPIO_DEBOUNCE(Keypad_Configuration->colConfiguration[_Loop_Variable_Branch].devicePortBaseAddress,
-                                           Keypad_Configuration->colConfiguration[_Loop_Variable_Branch].devicePin,LOW);
-
-                         /* Buffer the data */
-                         * keypad_returnData= Keypad_Configuration->returnDataArray[_Loop_Variable_Main][_Loop_Variable_Branch];
-                         return STD_OK;  /* Exit */
-                    }
+                  * keypad_returnData= _Event.key;
+                  return STD_OK;  /* Exit */
             }
-
       }
-      
+
       /* If the code reaches this point then no key pressed and NO ERROR happened */
       * keypad_returnData= KEYPAD_NOT_PRESSED;
       return STD_OK;
-}
\ No newline at end of file
+}
+
+/*****************************************************************************/
+/** Description: By a call to Keypad_isIdle It is known if the passed       **/
+/**              keypad has no held key, no key counting to a new level, no **/
+/**              queued event and no pending Keypad_sync.                   **/
+/**                                                                         **/
+/** Parameters: + Keypad_Configuration => Pointer to Keypad_ConfigType      **/
+/**                                       initialized by Keypad_init.       **/
+/**                                                                         **/
+/** Return: uint8 => - TRUE:  The keypad is idle.                           **/
+/**                  - FALSE: A key is held, moving or queued.              **/
+/*****************************************************************************/
+uint8 Keypad_isIdle(Keypad_ConfigType * Keypad_Configuration)
+{
+      uint8 _Channel;
+      Debounce_ChannelType * _Keys;
+
+      if(Keypad_Configuration->syncRequest == TRUE ||
+         Keypad_Configuration->eventsTail != Keypad_Configuration->eventsHead)
+      {
+            return FALSE;
+      }
+      for(_Channel=0; _Channel<KEYPAD_DEBOUNCE_CHANNELS; _Channel++)
+      {
+            _Keys=&(Keypad_Configuration->keyChannels[_Channel]);
+            if(_Keys->stable != 0 ||
+               _Keys->count0 != DEBOUNCE_RESET_COUNT0 ||
+               _Keys->count1 != DEBOUNCE_RESET_COUNT1)
+            {
+                  return FALSE;
+            }
+      }
+      return TRUE;
+}
@@ -0,0 +1,176 @@
+/*****************************************************************************/
+/** File:    Module_LcdBuffer.c                                             **/
+/**                                                                         **/
+/** Description: This file is the implementation of the LCD frame buffer.   **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "Module_LcdBuffer.h"
+#include "Module_LcdQueue.h"
+
+/* Local macros */
+#define LCDBUFFER_CURSOR_UNKNOWN  0xFF  /* Not a DDRAM address */
+
+/* Local variables */
+static char   LcdBuffer_Screen[LCDBUFFER_ROWS][LCDBUFFER_COLUMNS];
+static uint16 LcdBuffer_Dirty[LCDBUFFER_ROWS];  /* Column bits to send */
+static uint8  LcdBuffer_Cursor=LCDBUFFER_CURSOR_UNKNOWN; /* DDRAM address of LCD */
+
+/* DDRAM address of column 1 of every row */
+static const uint8 LcdBuffer_RowAddress[LCDBUFFER_ROWS]={
+        HD44780_ROW1_ADDRESS,HD44780_ROW2_ADDRESS,
+        HD44780_ROW3_ADDRESS,HD44780_ROW4_ADDRESS
+};
+
+/* Public functions defination */
+/*****************************************************************************/
+/** Description: By a call to LcdBuffer_init The LCD output queue is       **/
+/**              started, the LCD is cleared and the buffer starts blank.   **/
+/**              The LCD must be initialized before.                        **/
+/*****************************************************************************/
+void LcdBuffer_init(void)
+{
+      LcdQueue_init();
+      LcdBuffer_clear();
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdBuffer_clear The LCD is cleared with one   **/
+/**              command, the buffer is blank and nothing is left to flush. **/
+/**              With the queue full the cells are blanked and marked.      **/
+/*****************************************************************************/
+void LcdBuffer_clear(void)
+{
+      uint8 _Row;
+      uint8 _Column;
+
+      if(LcdQueue_cmd(HD44780_CLEAR) == STD_OK)
+      {
+            for(_Row=0; _Row<LCDBUFFER_ROWS; _Row++)
+            {
+                  for(_Column=0; _Column<LCDBUFFER_COLUMNS; _Column++)
+                  {
+                        LcdBuffer_Screen[_Row][_Column]=' ';
+                  }
+                  LcdBuffer_Dirty[_Row]=0;
+            }
+            LcdBuffer_Cursor=HD44780_ROW1_ADDRESS; /* Clear returns home */
+      }
+      else /* Queue full: blank cells flushed later */
+      {
+            for(_Row=1; _Row<=LCDBUFFER_ROWS; _Row++)
+            {
+                  for(_Column=1; _Column<=LCDBUFFER_COLUMNS; _Column++)
+                  {
+                        LcdBuffer_chr(_Row,_Column,' ');
+                  }
+            }
+      }
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdBuffer_chr One character is written to the **/
+/**              buffer, the cell is marked only if the character changed.  **/
+/**                                                                         **/
+/** Parameters: + Row => Row of the LCD (1..LCDBUFFER_ROWS).                **/
+/**             + Column => Column of the LCD (1..LCDBUFFER_COLUMNS).       **/
+/**             + Character => The character.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the cell is on the LCD.      **/
+/**                           - E_NOT_OK: If the row or column is out of    **/
+/**                                       the LCD.                          **/
+/*****************************************************************************/
+Std_ErrorType LcdBuffer_chr(uint8 Row, uint8 Column, char Character)
+{
+      if(Row < 1 || Row > LCDBUFFER_ROWS)                 return STD_ERROR;
+      if(Column < 1 || Column > LCDBUFFER_COLUMNS)        return STD_ERROR;
+
+      Row--;
+      Column--;
+      if(LcdBuffer_Screen[Row][Column] != Character)
+      {
+            LcdBuffer_Screen[Row][Column]=Character;
+            LcdBuffer_Dirty[Row] |= (uint16)1<<Column;
+      }
+      return STD_OK; /* If the code reaches this point then NO ERROR happened */
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdBuffer_out A text is written to the buffer **/
+/**              from the passed cell, the characters after the last column **/
+/**              are dropped.                                               **/
+/**                                                                         **/
+/** Parameters: + Row => Row of the LCD (1..LCDBUFFER_ROWS).                **/
+/**             + Column => Column of the first character                   **/
+/**                         (1..LCDBUFFER_COLUMNS).                         **/
+/**             + Text => Null terminated text.                             **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the cell is on the LCD.      **/
+/**                           - E_NOT_OK: If the row or column is out of    **/
+/**                                       the LCD.                          **/
+/*****************************************************************************/
+Std_ErrorType LcdBuffer_out(uint8 Row, uint8 Column, char * Text)
+{
+      if(Row < 1 || Row > LCDBUFFER_ROWS)                 return STD_ERROR;
+      if(Column < 1 || Column > LCDBUFFER_COLUMNS)        return STD_ERROR;
+
+      while(*Text != '\0' && Column <= LCDBUFFER_COLUMNS)
+      {
+            LcdBuffer_chr(Row,Column,*Text);
+            Column++;
+            Text++;
+      }
+      return STD_OK; /* If the code reaches this point then NO ERROR happened */
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdBuffer_flush The marked cells are queued  **/
+/**              for the LCD in address order. The LCD moves its cursor     **/
+/**              after every character, so the address is only set where    **/
+/**              the cursor isn't at the next marked cell. With one         **/
+/**              unmarked cell between, it is sent again (same bus time as  **/
+/**              the address command). The cells that don't fit in the      **/
+/**              queue stay marked for the next flush.                      **/
+/*****************************************************************************/
+void LcdBuffer_flush(void)
+{
+      uint8  _Row;
+      uint8  _Column;
+      uint8  _Address;
+      uint16 _Dirty;
+      uint16 _Bit;
+
+      for(_Row=0; _Row<LCDBUFFER_ROWS; _Row++)
+      {
+            _Dirty=LcdBuffer_Dirty[_Row];
+            _Address=LcdBuffer_RowAddress[_Row];
+            for(_Column=0, _Bit=0x0001; _Dirty != 0; _Column++, _Bit <<= 1, _Address++)
+            {
+                  if((_Dirty & _Bit) == 0)      continue;
+                  if(LcdQueue_getFree() < 2) /* Address and character */
+                  {
+                        LcdBuffer_Dirty[_Row]=_Dirty; /* Next flush */
+                        return;
+                  }
+                  if(LcdBuffer_Cursor != _Address)
+                  {
+                        if(_Column > 0 && LcdBuffer_Cursor == _Address-1)
+                        {
+                              LcdQueue_chr(LcdBuffer_Screen[_Row][_Column-1]);
+                        }
+                        else
+                        {
+                              LcdQueue_cmd(HD44780_SET_ADDRESS | _Address);
+                        }
+                  }
+                  LcdQueue_chr(LcdBuffer_Screen[_Row][_Column]);
+                  LcdBuffer_Cursor=_Address+1;
+                  _Dirty &= ~_Bit;
+            }
+            LcdBuffer_Dirty[_Row]=0;
+      }
+}
@@ -0,0 +1,193 @@
+/*****************************************************************************/
+/** File:    Module_LcdQueue.c                                              **/
+/**                                                                         **/
+/** Description: This file is the implementation of the LCD output queue.   **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "Module_LcdQueue.h"
+
+/* Local macros */
+#define LCDQUEUE_RS_DATA        0x01    /* Entry is a character */
+
+/* A byte sent after a busy flag read is late in its period (10 us), the */
+/* next one comes less than a period after it                            */
+#define LCDQUEUE_READ_BUSY_US   10
+#define LCDQUEUE_BYTE_IN_PERIOD \
+(LCDQUEUE_PERIOD_US >= HD44780_EXECUTION_US+LCDQUEUE_READ_BUSY_US)
+
+/* Local data types */
+typedef struct{
+        uint8 value;
+        uint8 flags;
+}LcdQueue_EntryType;
+
+/* Local variables */
+/* One LCD byte per Timer2 period, no prescaler, no postscaler */
+static HAL_Timer2_ConfigType LcdQueue_Timer2Config={
+        TIMER2_PRESCALER_OFF,
+        1,
+        LCDQUEUE_PERIOD_US*LCDQUEUE_TCY_PER_US-1
+};
+static LcdQueue_EntryType LcdQueue_Entries[LCDQUEUE_ENTRIES_NUMBER];
+static uint8 LcdQueue_Head=0;  /* Next free entry, written by main only */
+static uint8 LcdQueue_Tail=0;  /* Oldest entry, written by the interrupt only */
+#if LCD_RW_WIRED
+static uint8 LcdQueue_Busy=FALSE; /* Read the busy flag before the next byte */
+#else
+static uint8 LcdQueue_Wait=0;  /* Periods left of a long command */
+#endif
+
+/* Private functions prototype */
+static Std_ErrorType LcdQueue_put(uint8 Value, uint8 Flags);
+
+/* Private functions defination */
+/* Main context: queue one byte, never waits. Timer2 is started when the  */
+/* byte is the oldest one: the interrupt stops it on an empty queue only,  */
+/* the tail then stays on this entry until it is started again.           */
+static Std_ErrorType LcdQueue_put(uint8 Value, uint8 Flags)
+{
+      uint8 _Head=LcdQueue_Head;
+      uint8 _Next=(_Head+1) & (LCDQUEUE_ENTRIES_NUMBER-1);
+
+      if(_Next == LcdQueue_Tail)  return STD_ERROR; /* Full, the byte is dropped */
+      LcdQueue_Entries[_Head].value=Value;
+      LcdQueue_Entries[_Head].flags=Flags;
+      LcdQueue_Head=_Next;  /* Publish the entry */
+      if(LcdQueue_Tail == _Head)  HAL_Timer2_start(); /* Was empty */
+      return STD_OK; /* If the code reaches this point then NO ERROR happened */
+}
+
+/* Public functions defination */
+/*****************************************************************************/
+/** Description: By a call to LcdQueue_init The queue starts empty and      **/
+/**              Timer2 (no prescaler, no postscaler) is set to one LCD     **/
+/**              byte per period. It is stopped until a byte is queued.     **/
+/*****************************************************************************/
+void LcdQueue_init(void)
+{
+      LcdQueue_Head=0;
+      LcdQueue_Tail=0;
+#if LCD_RW_WIRED
+      LcdQueue_Busy=FALSE;
+#else
+      LcdQueue_Wait=0;
+#endif
+      HAL_Timer2_init(&LcdQueue_Timer2Config);
+      InterruptHandler_SetCallback(INT_TMR2,LcdQueue_update);
+      InterruptHandler_ClearFlag(INT_TMR2);
+      InterruptHandler_EnableInterrupt(INT_TMR2);
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdQueue_cmd One command is queued.           **/
+/**                                                                         **/
+/** Parameters: + Command => HD44780 command.                               **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the command is queued.       **/
+/**                           - E_NOT_OK: If the queue is full, the command **/
+/**                                       is dropped.                       **/
+/*****************************************************************************/
+Std_ErrorType LcdQueue_cmd(uint8 Command)
+{
+      return LcdQueue_put(Command,0);
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdQueue_chr One character is queued.         **/
+/**                                                                         **/
+/** Parameters: + Character => The character written at the LCD cursor.     **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the character is queued.     **/
+/**                           - E_NOT_OK: If the queue is full, the         **/
+/**                                       character is dropped.             **/
+/*****************************************************************************/
+Std_ErrorType LcdQueue_chr(char Character)
+{
+      return LcdQueue_put(Character,LCDQUEUE_RS_DATA);
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdQueue_update The oldest byte is sent as    **/
+/**              two nibbles (one port write each), the LCD has the whole   **/
+/**              period to execute it. Clear display and return home keep  **/
+/**              the bus until the busy flag is clear, or for               **/
+/**              LCDQUEUE_CLEAR_PERIODS without R/W. Timer2 stops on an     **/
+/**              empty queue.                                               **/
+/*****************************************************************************/
+void LcdQueue_update(void)
+{
+      uint8 _Tail=LcdQueue_Tail;
+      uint8 _Value;
+      uint8 _Flags;
+#if LCD_RW_WIRED
+      uint8 _Busy;
+
+      if(_Tail == LcdQueue_Head)  /* Nothing left, stop the periods */
+      {
+            HAL_Timer2_stop();
+            return;
+      }
+      if(LcdQueue_Busy)
+      {
+            HD44780_READ_BUSY(_Busy);
+            if(_Busy)   return;   /* Still executing, try next period */
+      }
+#else
+      if(LcdQueue_Wait != 0)
+      {
+            LcdQueue_Wait--;
+            return;
+      }
+      if(_Tail == LcdQueue_Head)  /* Nothing left, stop the periods */
+      {
+            HAL_Timer2_stop();
+            return;
+      }
+#endif
+
+      _Value=LcdQueue_Entries[_Tail].value;
+      _Flags=LcdQueue_Entries[_Tail].flags;
+      HD44780_WRITE_BYTE(_Flags & LCDQUEUE_RS_DATA,_Value);
+      if(!(_Flags & LCDQUEUE_RS_DATA) &&
+         (_Value == HD44780_CLEAR || _Value == HD44780_RETURN_HOME))
+      {
+#if LCD_RW_WIRED
+            LcdQueue_Busy=TRUE;
+      }
+      else
+      {
+            LcdQueue_Busy=!LCDQUEUE_BYTE_IN_PERIOD;
+#else
+            LcdQueue_Wait=LCDQUEUE_CLEAR_PERIODS-1;
+#endif
+      }
+      LcdQueue_Tail=(_Tail+1) & (LCDQUEUE_ENTRIES_NUMBER-1);
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdQueue_isEmpty It is known if all queued    **/
+/**              bytes were sent to the LCD.                                **/
+/**                                                                         **/
+/** Return: uint8 => - TRUE:  The queue is empty.                           **/
+/**                  - FALSE: Bytes are waiting.                            **/
+/*****************************************************************************/
+uint8 LcdQueue_isEmpty(void)
+{
+      return (LcdQueue_Tail == LcdQueue_Head) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/** Description: By a call to LcdQueue_getFree The free entries are known,  **/
+/**              the interrupt can only free more of them.                  **/
+/**                                                                         **/
+/** Return: uint8 => Bytes that can be queued now.                          **/
+/*****************************************************************************/
+uint8 LcdQueue_getFree(void)
+{
+      return (LcdQueue_Tail-LcdQueue_Head-1) & (LCDQUEUE_ENTRIES_NUMBER-1);
+}
@@ -0,0 +1,389 @@
+/*****************************************************************************/
+/** File:    Module_Profile.c                                               **/
+/**                                                                         **/
+/** Description: This file is the implementation of the profiler.           **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "Module_Profile.h"
+
+#if PROFILE_ENABLE
+#include "HAL_Timer3.h"
+#include "HAL_InterruptHandler.h"
+
+/* Local macros */
+#define PROFILE_CALIBRATIONS  4  /* Empty regions, the shortest is the cost */
+#define PROFILE_HISTOGRAMS    3
+
+/* Timer3 count, RD16 set: TMR3L latches TMR3H, one read of each */
+#define PROFILE_READ(VAR)  do{                                                  \
+      uint8 _Low=HAL_RegisterRead(TIMER3L_Reg);                                 \
+      (VAR)=((uint16)HAL_RegisterRead(TIMER3H_Reg)<<8) | _Low;                  \
+}while(0)
+
+/* Add one measure, the counts stop with calls. Macros so the interrupt   */
+/* (routine, latency) and main (regions) share no function.               */
+#define PROFILE_ADD(STATS,CYCLES)  do{                                          \
+      if((STATS).calls == 0xFFFF)                  break;                       \
+      if((STATS).calls == 0 || (CYCLES) < (STATS).min) (STATS).min=(CYCLES);    \
+      if((CYCLES) > (STATS).max)                   (STATS).max=(CYCLES);        \
+      (STATS).calls++;                                                          \
+      (STATS).total+=(CYCLES);                                                  \
+}while(0)
+
+#define PROFILE_HISTOGRAM_ADD(HISTOGRAM,CYCLES,SHIFT)  do{                      \
+      uint16 _Bin=(CYCLES)>>(SHIFT);                                            \
+      if(_Bin >= PROFILE_BINS)                  _Bin=PROFILE_BINS-1;            \
+      if((HISTOGRAM).bins[_Bin] < 0xFFFF)       (HISTOGRAM).bins[_Bin]++;       \
+      PROFILE_ADD((HISTOGRAM).stats,(CYCLES));                                  \
+}while(0)
+
+/* Local variables */
+/* Free running Tcy counter */
+static HAL_Timer3_ConfigType Profile_Timer3Config={
+        TIMER3_TIMER,
+        TIMER3_PRESCALER_OFF,
+        0
+};
+static const char * const Profile_RegionNames[PROFILE_REGIONS_NUMBER]=PROFILE_REGION_NAMES;
+static const char * const Profile_HistogramNames[PROFILE_HISTOGRAMS]=
+        {"T0Latency","ISR","ISRLow"};
+static const uint8 Profile_HistogramShifts[PROFILE_HISTOGRAMS]=
+        {PROFILE_LATENCY_BIN_SHIFT,PROFILE_ISR_BIN_SHIFT,PROFILE_ISR_BIN_SHIFT};
+static Profile_StatsType Profile_Regions[PROFILE_REGIONS_NUMBER];
+static Profile_HistogramType Profile_Histograms[PROFILE_HISTOGRAMS];
+static uint16 Profile_Start[PROFILE_REGIONS_NUMBER];    /* Count at begin */
+static uint16 Profile_StartIsr[PROFILE_REGIONS_NUMBER]; /* ISR Tcy at begin */
+static uint16 Profile_IsrStart;     /* Count at the interrupt routine entry */
+static uint16 Profile_IsrCycles;    /* Tcy in the high routine, wraps */
+static uint16 Profile_IsrLowStart;  /* Same for the low priority routine */
+static uint16 Profile_IsrLowHigh;   /* Profile_IsrCycles at its entry */
+static uint16 Profile_IsrLowCycles; /* Its Tcy, the high ones taken out */
+static uint16 Profile_Overhead;     /* Tcy of an empty region */
+static uint16 Profile_ReadOverhead; /* Tcy of one PROFILE_READ */
+
+/* Private functions prototype */
+static void Profile_putText(void (*Put)(char Character), const char * Text);
+static void Profile_putNumber(void (*Put)(char Character), uint32 Number);
+static void Profile_putStats(void (*Put)(char Character), const char * Name,
+                             Profile_StatsType * Stats);
+
+/* Private functions defination */
+static void Profile_putText(void (*Put)(char Character), const char * Text)
+{
+      while(*Text != '\0')
+      {
+            Put(*Text++);
+      }
+}
+
+/* Decimal, a space before */
+static void Profile_putNumber(void (*Put)(char Character), uint32 Number)
+{
+      char _Digits[10];
+      uint8 _Count=0;
+
+      do
+      {
+            _Digits[_Count++]=(char)('0'+Number%10);
+            Number/=10;
+      }while(Number != 0);
+      Put(' ');
+      while(_Count > 0)
+      {
+            Put(_Digits[--_Count]);
+      }
+}
+
+/* "name calls min max mean" */
+static void Profile_putStats(void (*Put)(char Character), const char * Name,
+                             Profile_StatsType * Stats)
+{
+      Profile_putText(Put,Name);
+      Profile_putNumber(Put,Stats->calls);
+      Profile_putNumber(Put,Stats->min);
+      Profile_putNumber(Put,Stats->max);
+      Profile_putNumber(Put,(Stats->calls == 0) ? 0 : Stats->total/Stats->calls);
+      Profile_putText(Put,"\r\n");
+}
+
+/* Public functions defination */
+/*****************************************************************************/
+/** Description: By a call to Profile_init Timer3 runs from 0 on Tcy, the   **/
+/**              cost of PROFILE_READ and of an empty region are measured,  **/
+/**              the shortest of PROFILE_CALIBRATIONS regions is kept.      **/
+/*****************************************************************************/
+void Profile_init(void)
+{
+      uint16 _First;
+      uint16 _Second;
+      uint8 _Index;
+
+      HAL_Timer3_updateConfig(&Profile_Timer3Config);
+      PROFILE_READ(_First);
+      PROFILE_READ(_Second);
+      Profile_ReadOverhead=_Second-_First;
+      Profile_Overhead=0;
+      Profile_reset();
+      for(_Index=0; _Index<PROFILE_CALIBRATIONS; _Index++)
+      {
+            Profile_begin(PROFILE_EDIT_MODE);
+            Profile_end(PROFILE_EDIT_MODE);
+      }
+      Profile_Overhead=Profile_Regions[PROFILE_EDIT_MODE].min;
+      Profile_reset();
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_begin The count and the interrupt     **/
+/**              routine Tcy are taken together, interrupts disabled.       **/
+/**                                                                         **/
+/** Parameters: + Region => One of the regions of Profile_Config.h.         **/
+/*****************************************************************************/
+void Profile_begin(uint8 Region)
+{
+      InterruptHandler_DisableGlobalInterrupt();
+      PROFILE_READ(Profile_Start[Region]);
+      Profile_StartIsr[Region]=Profile_IsrCycles+Profile_IsrLowCycles;
+      InterruptHandler_EnbleGlobalInterrupt();
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_end The Tcy since Profile_begin less  **/
+/**              the interrupt routine Tcy in between and the cost of an    **/
+/**              empty region are added to the region.                      **/
+/**                                                                         **/
+/** Parameters: + Region => One of the regions of Profile_Config.h.         **/
+/**                                                                         **/
+/** Note: The vectoring and context save of the interrupts in between are   **/
+/**       not taken out, a few Tcy each.                                    **/
+/*****************************************************************************/
+void Profile_end(uint8 Region)
+{
+      uint16 _Now;
+      uint16 _Isr;
+      uint16 _Cycles;
+
+      InterruptHandler_DisableGlobalInterrupt();
+      PROFILE_READ(_Now);
+      _Isr=Profile_IsrCycles+Profile_IsrLowCycles;
+      InterruptHandler_EnbleGlobalInterrupt();
+      _Cycles=(uint16)(_Now-Profile_Start[Region]-(uint16)(_Isr-Profile_StartIsr[Region]));
+      _Cycles=(_Cycles > Profile_Overhead) ? _Cycles-Profile_Overhead : 0;
+      PROFILE_ADD(Profile_Regions[Region],_Cycles);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_isrBegin The count at the start of a  **/
+/**              region of the high priority routine is kept, nothing can   **/
+/**              interrupt it.                                              **/
+/**                                                                         **/
+/** Parameters: + Region => One of the regions of Profile_Config.h.         **/
+/*****************************************************************************/
+void Profile_isrBegin(uint8 Region)
+{
+      PROFILE_READ(Profile_Start[Region]);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_isrEnd The Tcy since Profile_isrBegin **/
+/**              less one PROFILE_READ are added to the region.             **/
+/**                                                                         **/
+/** Parameters: + Region => One of the regions of Profile_Config.h.         **/
+/*****************************************************************************/
+void Profile_isrEnd(uint8 Region)
+{
+      uint16 _Now;
+      uint16 _Cycles;
+
+      PROFILE_READ(_Now);
+      _Cycles=_Now-Profile_Start[Region];
+      _Cycles=(_Cycles > Profile_ReadOverhead) ? _Cycles-Profile_ReadOverhead : 0;
+      PROFILE_ADD(Profile_Regions[Region],_Cycles);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_isrEntry The count at the entry of    **/
+/**              the interrupt routine is kept.                             **/
+/*****************************************************************************/
+void Profile_isrEntry(void)
+{
+      PROFILE_READ(Profile_IsrStart);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_isrExit The Tcy since the entry are   **/
+/**              added to the interrupt routine Tcy (taken out of the       **/
+/**              regions) and, less one PROFILE_READ, to the histogram.     **/
+/*****************************************************************************/
+void Profile_isrExit(void)
+{
+      uint16 _Now;
+      uint16 _Cycles;
+
+      PROFILE_READ(_Now);
+      _Cycles=_Now-Profile_IsrStart;
+      Profile_IsrCycles+=_Cycles;
+      _Cycles=(_Cycles > Profile_ReadOverhead) ? _Cycles-Profile_ReadOverhead : 0;
+      PROFILE_HISTOGRAM_ADD(Profile_Histograms[PROFILE_HISTOGRAM_ISR],_Cycles,PROFILE_ISR_BIN_SHIFT);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_isrLowEntry The count and the high    **/
+/**              priority routine Tcy are taken together: the high routine  **/
+/**              may interrupt in between, then they are taken again.       **/
+/*****************************************************************************/
+void Profile_isrLowEntry(void)
+{
+      do
+      {
+            Profile_IsrLowHigh=Profile_IsrCycles;
+            PROFILE_READ(Profile_IsrLowStart);
+      }while(Profile_IsrLowHigh != Profile_IsrCycles);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_isrLowExit The Tcy since the entry    **/
+/**              less the high priority routine Tcy in between are added    **/
+/**              to the low routine Tcy and, less one PROFILE_READ, to the  **/
+/**              histogram.                                                 **/
+/*****************************************************************************/
+void Profile_isrLowExit(void)
+{
+      uint16 _Now;
+      uint16 _High;
+      uint16 _Cycles;
+
+      do
+      {
+            _High=Profile_IsrCycles;
+            PROFILE_READ(_Now);
+      }while(_High != Profile_IsrCycles);
+      _Cycles=(uint16)(_Now-Profile_IsrLowStart-(uint16)(_High-Profile_IsrLowHigh));
+      Profile_IsrLowCycles+=_Cycles;
+      _Cycles=(_Cycles > Profile_ReadOverhead) ? _Cycles-Profile_ReadOverhead : 0;
+      PROFILE_HISTOGRAM_ADD(Profile_Histograms[PROFILE_HISTOGRAM_ISR_LOW],_Cycles,PROFILE_ISR_BIN_SHIFT);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_timer0Latency The latency is added to **/
+/**              its histogram.                                             **/
+/**                                                                         **/
+/** Parameters: + Cycles => Tcy since the Timer0 overflow.                  **/
+/*****************************************************************************/
+void Profile_timer0Latency(uint16 Cycles)
+{
+      PROFILE_HISTOGRAM_ADD(Profile_Histograms[PROFILE_HISTOGRAM_LATENCY],Cycles,PROFILE_LATENCY_BIN_SHIFT);
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_reset All statistics are cleared,     **/
+/**              interrupts disabled.                                       **/
+/*****************************************************************************/
+void Profile_reset(void)
+{
+      uint8 _Index;
+      uint8 _Bin;
+
+      InterruptHandler_DisableGlobalInterrupt();
+      for(_Index=0; _Index<PROFILE_REGIONS_NUMBER; _Index++)
+      {
+            Profile_Regions[_Index].calls=0;
+            Profile_Regions[_Index].min=0;
+            Profile_Regions[_Index].max=0;
+            Profile_Regions[_Index].total=0;
+      }
+      for(_Index=0; _Index<PROFILE_HISTOGRAMS; _Index++)
+      {
+            Profile_Histograms[_Index].stats.calls=0;
+            Profile_Histograms[_Index].stats.min=0;
+            Profile_Histograms[_Index].stats.max=0;
+            Profile_Histograms[_Index].stats.total=0;
+            for(_Bin=0; _Bin<PROFILE_BINS; _Bin++)
+            {
+                  Profile_Histograms[_Index].bins[_Bin]=0;
+            }
+      }
+      InterruptHandler_EnbleGlobalInterrupt();
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_getRegion The statistics of a region  **/
+/**              are copied.                                                **/
+/**                                                                         **/
+/** Parameters: + Region => One of the regions of Profile_Config.h.         **/
+/**             + Stats  => Pointer to the copy.                            **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When copied.                      **/
+/**                           - E_NOT_OK: If no region or NULL pointer.     **/
+/*****************************************************************************/
+Std_ErrorType Profile_getRegion(uint8 Region, Profile_StatsType * Stats)
+{
+      if(Region >= PROFILE_REGIONS_NUMBER || Stats == NULL_PTR) return STD_ERROR;
+
+      InterruptHandler_DisableGlobalInterrupt(); /* The ISR regions too */
+      *Stats=Profile_Regions[Region];
+      InterruptHandler_EnbleGlobalInterrupt();
+      return STD_OK;
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_getHistogram A histogram is copied,   **/
+/**              interrupts disabled as the routine writes it.              **/
+/**                                                                         **/
+/** Parameters: + Histogram => PROFILE_HISTOGRAM_LATENCY, _ISR or _ISR_LOW. **/
+/**             + Copy      => Pointer to the copy.                         **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When copied.                      **/
+/**                           - E_NOT_OK: If no histogram or NULL pointer.  **/
+/*****************************************************************************/
+Std_ErrorType Profile_getHistogram(uint8 Histogram, Profile_HistogramType * Copy)
+{
+      if(Histogram >= PROFILE_HISTOGRAMS || Copy == NULL_PTR) return STD_ERROR;
+
+      InterruptHandler_DisableGlobalInterrupt();
+      *Copy=Profile_Histograms[Histogram];
+      InterruptHandler_EnbleGlobalInterrupt();
+      return STD_OK;
+}
+
+/*****************************************************************************/
+/** Description: By a call to Profile_dump One line per region and per      **/
+/**              histogram: name, calls, min, max and mean Tcy, then the    **/
+/**              bins of the histogram.                                     **/
+/**                                                                         **/
+/** Parameters: + Put => Function which sends one character.                **/
+/*****************************************************************************/
+void Profile_dump(void (*Put)(char Character))
+{
+      Profile_HistogramType _Histogram;
+      Profile_StatsType _Region;
+      uint8 _Index;
+      uint8 _Bin;
+
+      Profile_putText(Put,"region calls min max mean (Tcy)\r\n");
+      for(_Index=0; _Index<PROFILE_REGIONS_NUMBER; _Index++)
+      {
+            Profile_getRegion(_Index,&_Region);
+            Profile_putStats(Put,Profile_RegionNames[_Index],&_Region);
+      }
+      for(_Index=0; _Index<PROFILE_HISTOGRAMS; _Index++)
+      {
+            Profile_getHistogram(_Index,&_Histogram);
+            Profile_putStats(Put,Profile_HistogramNames[_Index],&_Histogram.stats);
+            Profile_putText(Put,"  bins of");
+            Profile_putNumber(Put,1UL<<Profile_HistogramShifts[_Index]);
+            Profile_putText(Put,":");
+            for(_Bin=0; _Bin<PROFILE_BINS; _Bin++)
+            {
+                  Profile_putNumber(Put,_Histogram.bins[_Bin]);
+            }
+            Profile_putText(Put,"\r\n");
+      }
+}
+
+#endif /* PROFILE_ENABLE */
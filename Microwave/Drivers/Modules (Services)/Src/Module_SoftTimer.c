@@ -0,0 +1,197 @@
+/*****************************************************************************/
+/** File:    Module_SoftTimer.c                                             **/
+/**                                                                         **/
+/** Description: This file is the implementation of the software timers.    **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include "Module_SoftTimer.h"
+#include "HAL_InterruptHandler.h"
+
+/* Local macros */
+/* Link TIMER to expire TICKS (> 0) ticks from now, after the timers of the  */
+/* same deadline. A macro so the interrupt (periodic restart) and main       */
+/* (start) share no function.                                                */
+#define SOFTTIMER_LINK(TIMER,TICKS)  do{                                        \
+      SoftTimer_Type ** _Link=&SoftTimer_Head;                                  \
+      uint16 _Ticks=(TICKS);                                                    \
+      while(*_Link != NULL_PTR && (*_Link)->delta <= _Ticks)                    \
+      {                                                                         \
+            _Ticks-=(*_Link)->delta;                                            \
+            _Link=&((*_Link)->next);                                            \
+      }                                                                         \
+      if(*_Link != NULL_PTR)      (*_Link)->delta-=_Ticks;                      \
+      (TIMER)->delta=_Ticks;                                                    \
+      (TIMER)->next=*_Link;                                                     \
+      (TIMER)->running=TRUE;                                                    \
+      *_Link=(TIMER);                                                           \
+}while(0)
+
+/* Local variables */
+static SoftTimer_Type * SoftTimer_Head=NULL_PTR;  /* Next deadline first */
+
+/* Private functions prototype */
+static void SoftTimer_unlink(SoftTimer_Type * Timer);
+
+/* Private functions defination */
+/* Take a running timer out of the list, the next one gets its delta. */
+/* Called with interrupts disabled.                                   */
+static void SoftTimer_unlink(SoftTimer_Type * Timer)
+{
+      SoftTimer_Type ** _Link=&SoftTimer_Head;
+
+      while(*_Link != NULL_PTR && *_Link != Timer)
+      {
+            _Link=&((*_Link)->next);
+      }
+      if(*_Link == NULL_PTR)      return; /* Not running */
+      if(Timer->next != NULL_PTR) Timer->next->delta+=Timer->delta;
+      *_Link=Timer->next;
+      Timer->running=FALSE;
+}
+
+/* Public functions defination */
+/*****************************************************************************/
+/** Description: By a call to SoftTimer_start The timer is linked in the    **/
+/**              running list at its deadline, interrupts are disabled      **/
+/**              while the list changes.                                    **/
+/**                                                                         **/
+/** Parameters: + Timer => Pointer to SoftTimer_Type.                       **/
+/**             + Ticks => Ticks to the first expiration.                   **/
+/**             + Period => Ticks between the next expirations, 0 =>        **/
+/**                         one-shot.                                       **/
+/**                                                                         **/
+/** Return: Std_ReturnType => - STD_OK:   When the timer runs.              **/
+/**                           - E_NOT_OK: If Ticks is 0 or NULL pointer.    **/
+/*****************************************************************************/
+Std_ErrorType SoftTimer_start(SoftTimer_Type * Timer, uint16 Ticks, uint16 Period)
+{
+      if(Timer == NULL_PTR || Ticks == 0)     return STD_ERROR;
+
+      InterruptHandler_DisableGlobalInterrupt();
+      SoftTimer_unlink(Timer);
+      Timer->period=Period;
+      Timer->expirations=0;
+      SOFTTIMER_LINK(Timer,Ticks);
+      InterruptHandler_EnbleGlobalInterrupt();
+      return STD_OK; /* If the code reaches this point then NO ERROR happened */
+}
+
+/*****************************************************************************/
+/** Description: By a call to SoftTimer_stop The timer leaves the running   **/
+/**              list, the timer after it keeps its deadline.               **/
+/**                                                                         **/
+/** Parameters: + Timer => Pointer to SoftTimer_Type.                       **/
+/*****************************************************************************/
+void SoftTimer_stop(SoftTimer_Type * Timer)
+{
+      InterruptHandler_DisableGlobalInterrupt();
+      SoftTimer_unlink(Timer);
+      Timer->expirations=0;
+      InterruptHandler_EnbleGlobalInterrupt();
+}
+
+/*****************************************************************************/
+/** Description: By a call to SoftTimer_expired One expiration is taken, a  **/
+/**              pass which is late by more than a period sees the missed   **/
+/**              expirations in its next calls.                             **/
+/**                                                                         **/
+/** Parameters: + Timer => Pointer to SoftTimer_Type.                       **/
+/**                                                                         **/
+/** Return: uint8 => - TRUE:  The timer expired.                            **/
+/**                  - FALSE: No expiration left.                           **/
+/*****************************************************************************/
+uint8 SoftTimer_expired(SoftTimer_Type * Timer)
+{
+      uint8 _Expired=FALSE;
+
+      InterruptHandler_DisableGlobalInterrupt();
+      if(Timer->expirations > 0)
+      {
+            Timer->expirations--;
+            _Expired=TRUE;
+      }
+      InterruptHandler_EnbleGlobalInterrupt();
+      return _Expired;
+}
+
+/*****************************************************************************/
+/** Description: By a call to SoftTimer_remaining The deltas of the list    **/
+/**              are added up to the timer.                                 **/
+/**                                                                         **/
+/** Parameters: + Timer => Pointer to SoftTimer_Type.                       **/
+/**                                                                         **/
+/** Return: uint16 => Ticks to the next expiration, 0 if stopped.           **/
+/*****************************************************************************/
+uint16 SoftTimer_remaining(SoftTimer_Type * Timer)
+{
+      SoftTimer_Type * _Timer;
+      uint16 _Ticks=0;
+
+      InterruptHandler_DisableGlobalInterrupt();
+      for(_Timer=SoftTimer_Head; _Timer != NULL_PTR; _Timer=_Timer->next)
+      {
+            _Ticks+=_Timer->delta;
+            if(_Timer == Timer)     break;
+      }
+      if(_Timer == NULL_PTR)      _Ticks=0; /* Not running */
+      InterruptHandler_EnbleGlobalInterrupt();
+      return _Ticks;
+}
+
+/*****************************************************************************/
+/** Description: By a call to SoftTimer_nextDeadline The delta of the head  **/
+/**              is the ticks to the first expiration of all timers.        **/
+/**                                                                         **/
+/** Return: uint16 => Ticks to the next expiration, 0 if none runs.         **/
+/**                                                                         **/
+/** Note: Interrupts are not touched, the caller has them disabled.         **/
+/*****************************************************************************/
+uint16 SoftTimer_nextDeadline(void)
+{
+      if(SoftTimer_Head == NULL_PTR)      return 0;
+      return SoftTimer_Head->delta;
+}
+
+/*****************************************************************************/
+/** Description: By a call to SoftTimer_advance The ticks are taken from    **/
+/**              the head deltas, every timer at delta 0 leaves the list    **/
+/**              with one more expiration, a periodic one is linked again   **/
+/**              one period later. The other running timers are not         **/
+/**              touched while the ticks end before their deadline.         **/
+/**                                                                         **/
+/** Parameters: + Ticks => Ticks since the last call (1 with a fixed tick). **/
+/*****************************************************************************/
+void SoftTimer_advance(uint8 Ticks)
+{
+      SoftTimer_Type * _Timer;
+
+      while(Ticks > 0 && SoftTimer_Head != NULL_PTR)
+      {
+            if(SoftTimer_Head->delta > Ticks)
+            {
+                  SoftTimer_Head->delta-=Ticks;
+                  return;
+            }
+            Ticks-=(uint8)SoftTimer_Head->delta;
+            SoftTimer_Head->delta=0;
+            while(SoftTimer_Head != NULL_PTR && SoftTimer_Head->delta == 0)
+            {
+                  _Timer=SoftTimer_Head;
+                  SoftTimer_Head=_Timer->next;
+                  if(_Timer->expirations < 0xFF)      _Timer->expirations++;
+                  if(_Timer->period > 0)
+                  {
+                        SOFTTIMER_LINK(_Timer,_Timer->period);
+                  }
+                  else
+                  {
+                        _Timer->running=FALSE;
+                  }
+            }
+      }
+}
@@ -0,0 +1,35 @@
+/*****************************************************************************/
+/** File:    Sim_Bench.h                                                    **/
+/**                                                                         **/
+/** Description: This file define the benchmark scenarios of the host      **/
+/**              build which compare driver paths on the simulator.         **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _SIM_BENCH_H_
+#define _SIM_BENCH_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+
+/* Macros */
+#define SIM_BENCH_CALLS  1000000UL /* Calls of every measured path */
+
+/* Functions prototypes */
+/**
+  * @brief	GPIO_DeviceSet/Clear/Toggle/GetRead against the GPIO_Handle* and
+  *		compile-time pin APIs: SFR accesses and host time per call.
+  *		"make sizes" prints the code size of the same paths.
+  */
+void Sim_BenchGpio(void);
+
+/**
+  * @brief	One second-tick of the countdown (decrement and rendering) with
+  *		the binary time and six / % 10, and with the packed BCD time.
+  */
+void Sim_BenchTime(void);
+
+#endif /* _SIM_BENCH_H_ */
@@ -0,0 +1,250 @@
+/*****************************************************************************/
+/** File:    Sim_Core.h                                                     **/
+/**                                                                         **/
+/** Description: This file define all needed APIs of the host simulator of  **/
+/**              PIC18F4620: 4 KB register file with access counters, the  **/
+/**              ports, Timer0, Timer1 and Timer3 (on the 32.768 kHz        **/
+/**              crystal of Timer1 or Tcy), Timer2, interrupt flags and the **/
+/**              sleep instruction.                                         **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _SIM_CORE_H_
+#define _SIM_CORE_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+
+/* Macros */
+#define SIM_MEMORY_SIZE        4096      /* SFR + RAM address space */
+#define SIM_FOSC_HZ            8000000UL /* Oscillator of the target board */
+#define SIM_CYCLES_PER_US      (SIM_FOSC_HZ/4000000UL) /* Tcy per 1 us */
+#define SIM_CYCLES_PER_MS      (SIM_FOSC_HZ/4000UL)    /* Tcy per 1 ms */
+#define SIM_T1OSC_HZ           32768UL   /* Watch crystal on T1OSO/T1OSI */
+#define SIM_CYCLES_PER_ACCESS  2         /* Cost charged for every SFR access */
+#define SIM_ISR_ENTRY_CYCLES   3         /* Interrupt vectoring latency */
+#define SIM_MAX_EVENTS         256       /* Scheduled input changes */
+
+#define SIM_NUMBER_OF_PORTS    5
+
+/* Ports index used by input APIs */
+#define SIM_PORTA 0
+#define SIM_PORTB 1
+#define SIM_PORTC 2
+#define SIM_PORTD 3
+#define SIM_PORTE 4
+
+/* Registers address known by the simulator */
+#define SIM_PORTA_ADDRESS   0x0F80
+#define SIM_LATA_ADDRESS    0x0F89
+#define SIM_TRISA_ADDRESS   0x0F92
+#define SIM_ADCON1_ADDRESS  0x0FC1
+#define SIM_T0CON_ADDRESS   0x0FD5
+#define SIM_TMR0L_ADDRESS   0x0FD6
+#define SIM_TMR0H_ADDRESS   0x0FD7
+#define SIM_INTCON3_ADDRESS 0x0FF0
+#define SIM_INTCON2_ADDRESS 0x0FF1
+#define SIM_INTCON_ADDRESS  0x0FF2
+#define SIM_T1CON_ADDRESS   0x0FCD
+#define SIM_TMR1L_ADDRESS   0x0FCE
+#define SIM_TMR1H_ADDRESS   0x0FCF
+#define SIM_T3CON_ADDRESS   0x0FB1
+#define SIM_TMR3L_ADDRESS   0x0FB2
+#define SIM_TMR3H_ADDRESS   0x0FB3
+#define SIM_T2CON_ADDRESS   0x0FCA
+#define SIM_PR2_ADDRESS     0x0FCB
+#define SIM_TMR2_ADDRESS    0x0FCC
+#define SIM_PIE1_ADDRESS    0x0F9D
+#define SIM_PIR1_ADDRESS    0x0F9E
+#define SIM_PIE2_ADDRESS    0x0FA0
+#define SIM_PIR2_ADDRESS    0x0FA1
+#define SIM_IPR1_ADDRESS    0x0F9F
+#define SIM_IPR2_ADDRESS    0x0FA2
+#define SIM_RCON_ADDRESS    0x0FD0
+#define SIM_OSCCON_ADDRESS  0x0FD3
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is to collect the run statistics of the simulator.   **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - cycles       => Instruction cycles (Tcy) since reset.       **/
+/**           - sleepCycles  => Cycles spent in sleep.                      **/
+/**           - deepSleepCycles => Cycles in sleep with the main oscillator **/
+/**                                off (no timer counting Tcy).             **/
+/**           - wakeups      => Number of wakeups from sleep.               **/
+/**           - interrupts   => Number of serviced interrupts.              **/
+/**           - lowInterrupts  => Of them, the low priority ones (IPEN).    **/
+/**           - isrCycles    => Cycles spent in the interrupt routines.     **/
+/**           - highLatencyMax => Longest cycles from a high priority       **/
+/**                               source getting pending to its routine.    **/
+/**           - lowLatencyMax  => Same for the low priority sources.        **/
+/**           - timer0Overflows     => Number of Timer0 overflows.          **/
+/**           - timer0OverflowCycle => Cycle of the last Timer0 overflow.   **/
+/**           - timer1Overflows     => Number of Timer1 overflows.          **/
+/**           - timer1OverflowCycle => Cycle of the last Timer1 overflow.   **/
+/*****************************************************************************/
+typedef struct{
+        uint64 cycles;
+        uint64 sleepCycles;
+        uint64 deepSleepCycles;
+        uint64 isrCycles;
+        uint64 timer0OverflowCycle;
+        uint64 timer1OverflowCycle;
+        uint32 wakeups;
+        uint32 interrupts;
+        uint32 lowInterrupts;
+        uint32 highLatencyMax;
+        uint32 lowLatencyMax;
+        uint32 timer0Overflows;
+        uint32 timer1Overflows;
+}Sim_StatsType;
+
+/*****************************************************************************/
+/** Description: This is the host stand-in of mikroC sbit (register+bit).   **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/*****************************************************************************/
+typedef struct{
+        uint16 address;
+        uint8  bitNo;
+}Sim_SbitType;
+
+/* Externed variables */
+extern uint8 Sim_Memory[SIM_MEMORY_SIZE];  /* The register file */
+extern Sim_StatsType Sim_Stats;
+
+/* Functions prototypes */
+/**
+  * @brief	By a call to Sim_Reset the register file, counters, timers and
+  *			scheduled events are set to the power on reset state.
+  *	@param	None.
+  *	@return	None.
+  */
+void Sim_Reset(void);
+
+/**
+  * @brief	Register access used by HAL_RegisterAccess.h in host build, each
+  *			call is counted and costs SIM_CYCLES_PER_ACCESS cycles.
+  */
+uint8 Sim_RegisterRead(uint16 address);
+void  Sim_RegisterWrite(uint16 address, uint8 value);
+void  Sim_RegisterSetBit(uint16 address, uint8 bitNo);
+void  Sim_RegisterClearBit(uint16 address, uint8 bitNo);
+void  Sim_RegisterToggleBit(uint16 address, uint8 bitNo);
+void  Sim_RegisterSetMask(uint16 address, uint8 mask);
+void  Sim_RegisterClearMask(uint16 address, uint8 mask);
+void  Sim_RegisterToggleMask(uint16 address, uint8 mask);
+
+/**
+  * @brief	The hook is called after every write of a port latch (PORTx,
+  *			LATx) with the port index and its new latch, NULL_PTR removes it.
+  *			It is used to connect devices driven by the pins (the LCD).
+  */
+void Sim_SetLatchHook(void (*hook)(uint8 port, uint8 latch));
+
+/**
+  * @brief	The hook is called when the firmware executes SLEEP, before the
+  *			core stops, NULL_PTR removes it. It is used to check the state
+  *			the firmware sleeps in (OSCCON, queues).
+  */
+void Sim_SetSleepHook(void (*hook)(void));
+
+/**
+  * @brief	Access counters of one register and of the whole register file.
+  */
+void   Sim_ResetCounters(void);
+uint32 Sim_GetReadCount(uint16 address);
+uint32 Sim_GetWriteCount(uint16 address);
+uint32 Sim_GetTotalReads(void);
+uint32 Sim_GetTotalWrites(void);
+
+/**
+  * @brief	By a call to Sim_ReportCounters every accessed register is
+  *			printed with its reads and writes.
+  *	@param	title Header line of the report.
+  *	@return	None.
+  */
+void Sim_ReportCounters(const char * title);
+
+/**
+  * @brief	Name of the register at address or NULL_PTR if not known.
+  */
+const char * Sim_RegisterName(uint16 address);
+
+/**
+  * @brief	By a call to Sim_Advance the simulated time runs for the passed
+  *			cycles (timers, scheduled events) without servicing interrupts.
+  */
+void Sim_Advance(uint64 cycles);
+
+/**
+  * @brief	Sim_Execute charges cycles of executed code, then services any
+  *			pending interrupt like the core does between instructions.
+  */
+void Sim_Execute(uint32 cycles);
+
+/**
+  * @brief	Host stand-in of the sleep instruction, it returns after the
+  *			first wakeup source (and its ISR if GIE is set).
+  */
+void Sim_Sleep(void);
+
+/**
+  * @brief	Longest cycles from the flag of a source (enabled) to the entry
+  *			of the interrupt routine which serviced it, since reset.
+  *	@param	flagAddress INTCON, INTCON3, PIR1 or PIR2 address.
+  *	@param	bitNo Flag bit of the source.
+  */
+uint32 Sim_LatencyMax(uint16 flagAddress, uint8 bitNo);
+
+/**
+  * @brief	Simulated time since reset in cycles and in milliseconds.
+  */
+uint64 Sim_Now(void);
+uint32 Sim_NowMs(void);
+
+/**
+  * @brief	External level of an input pin, now or at time atMs.
+  */
+void Sim_SetInput(uint8 port, uint8 pin, uint8 level);
+void Sim_ScheduleInput(uint32 atMs, uint8 port, uint8 pin, uint8 level);
+void Sim_ScheduleInputCycle(uint64 cycle, uint8 port, uint8 pin, uint8 level);
+
+/**
+  * @brief	Cycle of the next Timer0 overflow, 0 while it is stopped. With
+  *			Sim_ScheduleInputCycle an edge is placed against the tick.
+  */
+uint64 Sim_Timer0NextOverflow(void);
+
+/**
+  * @brief	Keypad matrix model, a pressed key shorts its column pin to its
+  *			row pin so the column reads LOW while the row is driven LOW.
+  *	@param	rowsPort/rowsPin/colsPort/colsPin Port index and pin of each
+  *			row and column.
+  */
+void Sim_KeypadConnect(uint8 rowsNumber, const uint8 * rowsPort, const uint8 * rowsPin,
+                       uint8 colsNumber, const uint8 * colsPort, const uint8 * colsPin);
+void Sim_SetKey(uint8 row, uint8 col, uint8 down);
+void Sim_ScheduleKey(uint32 atMs, uint8 row, uint8 col, uint8 down);
+
+/**
+  * @brief	The probe function is called at atMs of simulated time, it is
+  *			used to look at the firmware while it runs.
+  */
+void Sim_ScheduleProbe(uint32 atMs, void (*probe)(void));
+
+/**
+  * @brief	By a call to Sim_RunFirmware the firmware entry point runs until
+  *			the simulated time reaches durationMs, then the call returns.
+  *	@param	entry The firmware main function.
+  *	@param	durationMs Simulated time to run.
+  *	@return	None.
+  */
+void Sim_RunFirmware(void (*entry)(void), uint32 durationMs);
+
+#endif /* _SIM_CORE_H_ */
@@ -0,0 +1,112 @@
+/*****************************************************************************/
+/** File:    Sim_Lcd.h                                                      **/
+/**                                                                         **/
+/** Description: This file define the host APIs of the simulated 4x16 LCD  **/
+/**              on the pins of the firmware HD44780 driver.                **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _SIM_LCD_H_
+#define _SIM_LCD_H_
+
+/* Inclusion */
+#include "StdTypes.h"
+
+/* Macros */
+#define SIM_LCD_ROWS     4
+#define SIM_LCD_COLUMNS  16
+
+#define SIM_LCD_NOT_WIRED  0xFF   /* R/W pin tied LOW */
+
+/* Execution times of the datasheet (fosc = 270 kHz, 10 and 410 clocks) */
+#define SIM_LCD_BYTE_NS    37000UL
+#define SIM_LCD_CLEAR_NS   1520000UL
+
+/* Bus timing of the datasheet (HD44780U, Vcc = 5 V) */
+#define SIM_LCD_TAS_NS     40     /* RS, R/W setup before EN rise */
+#define SIM_LCD_TAH_NS     10     /* RS, R/W hold after EN fall */
+#define SIM_LCD_PWEH_NS    230    /* EN HIGH width */
+#define SIM_LCD_TCYCE_NS   500    /* EN cycle */
+#define SIM_LCD_TDSW_NS    80     /* Data setup before EN fall */
+#define SIM_LCD_TH_NS      10     /* Data hold after EN fall */
+
+/* User-defined data types */
+/*****************************************************************************/
+/** Description: This is to collect the LCD bus statistics.                 **/
+/**                                                                         **/
+/** Type: Structure.                                                        **/
+/**                                                                         **/
+/** Elements: - commands    => Number of command bytes.                     **/
+/**           - characters  => Number of data bytes.                        **/
+/**           - enablePulses => Number of EN pulses (writes and reads).     **/
+/**           - busyReads   => Number of busy flag reads.                   **/
+/**           - busyWrites  => Bytes written while the LCD was busy (lost   **/
+/**                            on a real LCD, execution time violation).    **/
+/**           - setupErrors => RS, R/W or data setup time violations.       **/
+/**           - holdErrors  => RS, R/W or data hold time violations.        **/
+/**           - pulseErrors => EN HIGH width or EN cycle violations.        **/
+/**           - busCycles   => Cycles the bus is used, from the first EN    **/
+/**                            rise of a byte to the end of its execution.  **/
+/**           - pollCycles  => Cycles R/W is HIGH (busy flag reads).        **/
+/*****************************************************************************/
+typedef struct{
+        uint32 commands;
+        uint32 characters;
+        uint32 enablePulses;
+        uint32 busyReads;
+        uint32 busyWrites;
+        uint32 setupErrors;
+        uint32 holdErrors;
+        uint32 pulseErrors;
+        uint64 busCycles;
+        uint64 pollCycles;
+}Sim_LcdStatsType;
+
+/* Externed variables */
+extern Sim_LcdStatsType Sim_LcdStats;
+
+/* Functions prototypes */
+/**
+  * @brief	Connect the LCD to the pins written by the firmware 4 bits
+  *			driver: RS, R/W (SIM_LCD_NOT_WIRED if tied LOW) and EN on
+  *			controlPort, D4..D7 from d4Pin of dataPort. It is a power on,
+  *			the LCD starts blank on the 8 bits bus.
+  */
+void Sim_LcdConnect(uint8 controlPort, uint8 rsPin, uint8 rwPin, uint8 enPin,
+                    uint8 dataPort, uint8 d4Pin);
+
+/**
+  * @brief	Execution time of a byte and of clear display / return home,
+  *			the LCD is busy for it after every instruction. It is kept
+  *			over Sim_LcdConnect.
+  */
+void Sim_LcdSetExecution(uint32 byteNs, uint32 clearNs);
+
+/**
+  * @brief	Start a frame: statistics are cleared. Sim_LcdReport prints the
+  *			transactions and the violations of the frame (the first ones
+  *			are printed when they happen).
+  */
+void Sim_LcdResetStats(void);
+void Sim_LcdReport(const char * title);
+
+/**
+  * @brief	Number of timing violations (setup, hold, EN, execution) since
+  *			the last Sim_LcdResetStats.
+  */
+uint32 Sim_LcdViolations(void);
+
+/**
+  * @brief	Copy one row (0..3) of the glass to buffer (17 bytes).
+  */
+void Sim_LcdGetRow(uint8 row, char * buffer);
+
+/**
+  * @brief	Print the 4x16 screen to stdout.
+  */
+void Sim_LcdRender(void);
+
+#endif /* _SIM_LCD_H_ */
@@ -0,0 +1,139 @@
+/*****************************************************************************/
+/** File:    Sim_mikroC.h                                                   **/
+/**                                                                         **/
+/** Description: This file is force-included in every host translation     **/
+/**              unit, it stands in for the implicit mikroC PRO P18F4620    **/
+/**              definitions used by the firmware (bit, sbit, SFR bits,     **/
+/**              _asm sleep and delays).                                    **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _SIM_MIKROC_H_
+#define _SIM_MIKROC_H_
+
+/* mikroC bit type */
+typedef unsigned char bit;
+
+/* Inclusion */
+#include "Sim_Core.h"
+
+/* Firmware entry point is renamed so the simulator owns main() */
+#define main Firmware_main
+void Firmware_main(void);
+
+/* Interrupt routines, called by the simulator when an interrupt is taken: */
+/* high priority (every source while IPEN is clear) and low priority       */
+void interrupt(void);
+void interrupt_low(void);
+
+/* _asm sleep => the simulated sleep instruction */
+#define _asm
+#define sleep Sim_Sleep()
+
+/* sbit NAME at Rxy_bit; => const Sim_SbitType NAME = {address,bit}; */
+#define sbit const Sim_SbitType
+#define at   =
+
+#define RD0_bit {0x0F83,0}
+#define RD1_bit {0x0F83,1}
+#define RD2_bit {0x0F83,2}
+#define RD3_bit {0x0F83,3}
+#define RD4_bit {0x0F83,4}
+#define RD5_bit {0x0F83,5}
+#define RD6_bit {0x0F83,6}
+#define RD7_bit {0x0F83,7}
+#define RE0_bit {0x0F84,0}
+#define RE1_bit {0x0F84,1}
+#define RE2_bit {0x0F84,2}
+#define TRISD0_bit {0x0F95,0}
+#define TRISD1_bit {0x0F95,1}
+#define TRISD2_bit {0x0F95,2}
+#define TRISD3_bit {0x0F95,3}
+#define TRISD4_bit {0x0F95,4}
+#define TRISD5_bit {0x0F95,5}
+#define TRISD6_bit {0x0F95,6}
+#define TRISD7_bit {0x0F95,7}
+#define TRISE0_bit {0x0F96,0}
+#define TRISE1_bit {0x0F96,1}
+#define TRISE2_bit {0x0F96,2}
+
+/* Interrupt enable bits numbers (P18F4620 definitions) */
+#define RBIE    3
+#define INT0IE  4
+#define TMR0IE  5
+#define INT1IE  3
+#define INT2IE  4
+#define TMR1IE  0
+#define TMR2IE  1
+#define CCP1IE  2
+#define SSPIE   3
+#define TXIE    4
+#define RCIE    5
+#define ADIE    6
+#define PSPIE   7
+#define CCP2IE  0
+#define TMR3IE  1
+#define HLVDIE  2
+#define BCLIE   3
+#define EEIE    4
+#define CMIE    6
+#define OSCFIE  7
+
+/* SFR bit access such as INTCON.TMR0IF (not counted by the simulator) */
+typedef struct{
+        unsigned char RBIF   :1;
+        unsigned char INT0IF :1;
+        unsigned char TMR0IF :1;
+        unsigned char _RBIE  :1;
+        unsigned char _INT0IE:1;
+        unsigned char _TMR0IE:1;
+        unsigned char PEIE   :1;
+        unsigned char GIE    :1;
+}Sim_INTCONbitsType;
+
+typedef struct{
+        unsigned char INT1IF :1;
+        unsigned char INT2IF :1;
+        unsigned char        :1;
+        unsigned char _INT1IE:1;
+        unsigned char _INT2IE:1;
+        unsigned char        :1;
+        unsigned char INT1IP :1;
+        unsigned char INT2IP :1;
+}Sim_INTCON3bitsType;
+
+typedef struct{
+        unsigned char TMR1IF :1;
+        unsigned char TMR2IF :1;
+        unsigned char CCP1IF :1;
+        unsigned char SSPIF  :1;
+        unsigned char TXIF   :1;
+        unsigned char RCIF   :1;
+        unsigned char ADIF   :1;
+        unsigned char PSPIF  :1;
+}Sim_PIR1bitsType;
+
+typedef struct{
+        unsigned char SCS0   :1;
+        unsigned char SCS1   :1;
+        unsigned char IOFS   :1;
+        unsigned char OSTS   :1;
+        unsigned char IRCF0  :1;
+        unsigned char IRCF1  :1;
+        unsigned char IRCF2  :1;
+        unsigned char IDLEN  :1;
+}Sim_OSCCONbitsType;
+
+#define INTCON  (*(Sim_INTCONbitsType *)&Sim_Memory[SIM_INTCON_ADDRESS])
+#define INTCON3 (*(Sim_INTCON3bitsType *)&Sim_Memory[SIM_INTCON3_ADDRESS])
+#define PIR1    (*(Sim_PIR1bitsType *)&Sim_Memory[SIM_PIR1_ADDRESS])
+#define OSCCON  (*(Sim_OSCCONbitsType *)&Sim_Memory[SIM_OSCCON_ADDRESS])
+
+/* Delays */
+#define Delay_us(TIME) Sim_Execute((uint32)(TIME)*SIM_CYCLES_PER_US)
+#define Delay_ms(TIME) Sim_Execute((uint32)(TIME)*SIM_CYCLES_PER_MS)
+
+#endif /* _SIM_MIKROC_H_ */
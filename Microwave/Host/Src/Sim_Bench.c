@@ -0,0 +1,282 @@
+/*****************************************************************************/
+/** File:    Sim_Bench.c                                                    **/
+/**                                                                         **/
+/** Description: This file implement the benchmark scenarios of the host   **/
+/**              build. Every path is wrapped in a non inlined function so  **/
+/**              "make sizes" can print its code size with nm. "static"     **/
+/**              is the compile-time pin API or the port-group API,        **/
+/**              "handle" the validate-once GPIO_Handle* API.               **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include <stdio.h>
+#include <time.h>
+#include "Sim_Core.h"
+#include "Sim_Bench.h"
+#include "HAL_GPIO.h"
+#include "Pins_Config.h"
+#include "Module_LcdBuffer.h"
+#include "APP_Functions.h"
+
+/* Local macros */
+#define SIM_BENCH_PATH  __attribute__((noinline))
+#define SIM_BENCH_REPEAT 7               /* Best of, against host noise */
+#define SIM_BENCH_ROW_PIN PORTD_BASE_ADDRESS,PIN_3  /* Keypad row, no shadow */
+
+#define SIM_BENCH_SECONDS 360000UL      /* Second-ticks of the time bench (100 h) */
+
+/* Local data types */
+/* Time_DataType before packed BCD: binary fields */
+typedef struct{
+        sint8 seconds;
+        sint8 minutes;
+        sint8 hours;
+}Sim_BenchBinaryTimeType;
+
+typedef struct{
+        const char * name;
+        void (*legacy)(void);
+        void (*handle)(void);  /* NULL_PTR if there is no handle path */
+        void (*fast)(void);
+}Sim_BenchGpioCaseType;
+
+/* Local variables */
+static HAL_GPIO_DeviceType Sim_BenchHeater={HEATER_PIN,OUTPUT};
+static HAL_GPIO_DeviceType Sim_BenchStart ={START_BUTTON_PIN,INPUT};
+static HAL_GPIO_DeviceType Sim_BenchLamp  ={LAMP_PIN,OUTPUT};
+static HAL_GPIO_DeviceType Sim_BenchMotor ={MOTOR_PIN,OUTPUT};
+static HAL_GPIO_DeviceType * const Sim_BenchCookingDevices[]={&Sim_BenchLamp,&Sim_BenchHeater,&Sim_BenchMotor};
+static HAL_GPIO_GroupType Sim_BenchCookingGroup;
+static HAL_GPIO_HandleType Sim_BenchHeaterHandle;
+static HAL_GPIO_HandleType Sim_BenchStartHandle;
+static HAL_GPIO_DeviceType Sim_BenchRow={SIM_BENCH_ROW_PIN,OUTPUT};
+static HAL_GPIO_HandleType Sim_BenchRowHandle;
+static volatile uint8 Sim_BenchSink;  /* Keeps the reads alive */
+static Sim_BenchBinaryTimeType Sim_BenchBinaryTime;
+static Time_DataType Sim_BenchBcdTime;
+static uint32 Sim_BenchDivisions;     /* Library divisions of the PIC18 path */
+
+/* Private functions prototype */
+static double Sim_BenchNowNs(void);
+static double Sim_BenchRun(const char * name, const char * path, void (*call)(void), double base);
+
+/* Measured paths */
+SIM_BENCH_PATH void Sim_BenchGpioLegacySet(void)    { GPIO_DeviceSet(&Sim_BenchHeater); }
+SIM_BENCH_PATH void Sim_BenchGpioLegacyClear(void)  { GPIO_DeviceClear(&Sim_BenchHeater); }
+SIM_BENCH_PATH void Sim_BenchGpioLegacyToggle(void) { GPIO_DeviceToggle(&Sim_BenchHeater); }
+SIM_BENCH_PATH void Sim_BenchGpioLegacyRead(void)
+{
+      HAL_GPIO_StatusType _Reading;
+
+      GPIO_DeviceGetRead(&Sim_BenchStart,&_Reading);
+      Sim_BenchSink=(_Reading==LOW);
+}
+SIM_BENCH_PATH void Sim_BenchGpioHandleSet(void)    { GPIO_HandleSet(&Sim_BenchHeaterHandle); }
+SIM_BENCH_PATH void Sim_BenchGpioHandleClear(void)  { GPIO_HandleClear(&Sim_BenchHeaterHandle); }
+SIM_BENCH_PATH void Sim_BenchGpioHandleToggle(void) { GPIO_HandleToggle(&Sim_BenchHeaterHandle); }
+SIM_BENCH_PATH void Sim_BenchGpioHandleRead(void)
+{
+      Sim_BenchSink=(GPIO_HandleGetRead(&Sim_BenchStartHandle)==LOW);
+}
+SIM_BENCH_PATH void Sim_BenchGpioLegacyRowClear(void) { GPIO_DeviceClear(&Sim_BenchRow); }
+SIM_BENCH_PATH void Sim_BenchGpioHandleRowClear(void) { GPIO_HandleClear(&Sim_BenchRowHandle); }
+SIM_BENCH_PATH void Sim_BenchGpioStaticRowClear(void) { GPIO_PIN_CLEAR(SIM_BENCH_ROW_PIN); }
+SIM_BENCH_PATH void Sim_BenchGpioStaticSet(void)    { GPIO_PIN_SET(HEATER_PIN); }
+SIM_BENCH_PATH void Sim_BenchGpioStaticClear(void)  { GPIO_PIN_CLEAR(HEATER_PIN); }
+SIM_BENCH_PATH void Sim_BenchGpioStaticToggle(void) { GPIO_PIN_TOGGLE(HEATER_PIN); }
+SIM_BENCH_PATH void Sim_BenchGpioStaticRead(void)
+{
+      Sim_BenchSink=(GPIO_PIN_READ(START_BUTTON_PIN)==LOW);
+}
+SIM_BENCH_PATH void Sim_BenchGpioLegacyCookOn(void)
+{
+      GPIO_DeviceSet(&Sim_BenchLamp);
+      GPIO_DeviceSet(&Sim_BenchHeater);
+      GPIO_DeviceSet(&Sim_BenchMotor);
+}
+SIM_BENCH_PATH void Sim_BenchGpioGroupCookOn(void)  { GPIO_GroupSet(&Sim_BenchCookingGroup); }
+
+/* No hardware divider on PIC18: / and % by 10 are a library call, */
+/* modelled by the shift-subtract loop of an 8 bits division.       */
+SIM_BENCH_PATH static uint8 Sim_BenchDiv8(uint8 dividend, uint8 divisor, uint8 * remainder)
+{
+      uint8 _Quotient=0;
+      uint8 _Rest=0;
+      uint8 _Bit;
+
+      Sim_BenchDivisions++;
+      for(_Bit=8; _Bit>0; _Bit--)
+      {
+            _Rest=(uint8)((_Rest<<1) | ((dividend>>(_Bit-1)) & 1));
+            _Quotient<<=1;
+            if(_Rest >= divisor)
+            {
+                  _Rest-=divisor;
+                  _Quotient|=1;
+            }
+      }
+      *remainder=_Rest;
+      return _Quotient;
+}
+
+/* One second of the countdown before: binary cascade and six / % 10 */
+SIM_BENCH_PATH void Sim_BenchTimeBinary(void)
+{
+      Sim_BenchBinaryTimeType * _Time=&Sim_BenchBinaryTime;
+      uint8 _Rest;
+
+      if(_Time->seconds>0)
+      {
+          _Time->seconds--;
+      }
+      else
+      {
+          _Time->seconds=59;
+          if(_Time->minutes>0)
+          {
+              _Time->minutes--;
+          }
+          else
+          {
+              _Time->minutes=59;
+              if(_Time->hours>0) _Time->hours--;
+          }
+      }
+      LcdBuffer_chr(1,6,Sim_BenchDiv8(_Time->hours,10,&_Rest)+'0');
+      Sim_BenchDiv8(_Time->hours,10,&_Rest);
+      LcdBuffer_chr(1,7,_Rest+'0');
+      LcdBuffer_chr(1,8,':');
+      LcdBuffer_chr(1,9,Sim_BenchDiv8(_Time->minutes,10,&_Rest)+'0');
+      Sim_BenchDiv8(_Time->minutes,10,&_Rest);
+      LcdBuffer_chr(1,10,_Rest+'0');
+      LcdBuffer_chr(1,11,':');
+      LcdBuffer_chr(1,12,Sim_BenchDiv8(_Time->seconds,10,&_Rest)+'0');
+      Sim_BenchDiv8(_Time->seconds,10,&_Rest);
+      LcdBuffer_chr(1,13,_Rest+'0');
+}
+
+/* One second of the countdown now: BCD decrement and nibbles */
+SIM_BENCH_PATH void Sim_BenchTimeBcd(void)
+{
+      APP_TimeDecrement(&Sim_BenchBcdTime);
+      APP_Timeupdate(&Sim_BenchBcdTime);
+}
+
+static const Sim_BenchGpioCaseType Sim_BenchGpioCases[]={
+        {"set",    Sim_BenchGpioLegacySet,     Sim_BenchGpioHandleSet,     Sim_BenchGpioStaticSet},
+        {"clear",  Sim_BenchGpioLegacyClear,   Sim_BenchGpioHandleClear,   Sim_BenchGpioStaticClear},
+        {"toggle", Sim_BenchGpioLegacyToggle,  Sim_BenchGpioHandleToggle,  Sim_BenchGpioStaticToggle},
+        {"read",   Sim_BenchGpioLegacyRead,    Sim_BenchGpioHandleRead,    Sim_BenchGpioStaticRead},
+        {"row-clr",Sim_BenchGpioLegacyRowClear,Sim_BenchGpioHandleRowClear,Sim_BenchGpioStaticRowClear},
+        {"cook-on",Sim_BenchGpioLegacyCookOn,  NULL_PTR,                   Sim_BenchGpioGroupCookOn}
+};
+
+/* Private functions defination */
+static double Sim_BenchNowNs(void)
+{
+      struct timespec _Now;
+
+      clock_gettime(CLOCK_MONOTONIC,&_Now);
+      return (double)_Now.tv_sec*1e9+(double)_Now.tv_nsec;
+}
+
+/* Returns host ns per call, base is the ns of the reference path (0 => none) */
+static double Sim_BenchRun(const char * name, const char * path, void (*call)(void), double base)
+{
+      uint32 _Index;
+      uint8  _Repeat;
+      double _Start;
+      double _Time;
+      double _Elapsed=0;
+
+      for(_Repeat=0; _Repeat<SIM_BENCH_REPEAT; _Repeat++)
+      {
+            Sim_ResetCounters();
+            _Start=Sim_BenchNowNs();
+            for(_Index=0; _Index<SIM_BENCH_CALLS; _Index++) call();
+            _Time=(Sim_BenchNowNs()-_Start)/SIM_BENCH_CALLS;
+            if(_Repeat==0 || _Time<_Elapsed) _Elapsed=_Time;
+      }
+      printf("  %-7s %-7s %6.2f reads %6.2f writes %8.1f ns",name,path,
+             (double)Sim_GetTotalReads()/SIM_BENCH_CALLS,
+             (double)Sim_GetTotalWrites()/SIM_BENCH_CALLS,_Elapsed);
+      if(base > 0) printf("  %+6.1f ns",_Elapsed-base);
+      printf("\n");
+      return _Elapsed;
+}
+
+/* Global functions defination */
+void Sim_BenchGpio(void)
+{
+      uint8 _Index;
+      double _Base;
+
+      Sim_Reset();
+      GPIO_DeviceInit(&Sim_BenchHeater);
+      GPIO_DeviceInit(&Sim_BenchStart);
+      GPIO_DeviceInit(&Sim_BenchLamp);
+      GPIO_DeviceInit(&Sim_BenchMotor);
+      GPIO_GroupInit(&Sim_BenchCookingGroup,Sim_BenchCookingDevices,3);
+      GPIO_DeviceInitHandle(&Sim_BenchHeater,&Sim_BenchHeaterHandle);
+      GPIO_DeviceInitHandle(&Sim_BenchStart,&Sim_BenchStartHandle);
+      GPIO_DeviceInitHandle(&Sim_BenchRow,&Sim_BenchRowHandle);
+      printf("  per call, best of %u x %lu calls (host time includes the simulator,\n"
+             "  last column is the difference against the device path)\n",
+             SIM_BENCH_REPEAT,SIM_BENCH_CALLS);
+      for(_Index=0; _Index<sizeof(Sim_BenchGpioCases)/sizeof(Sim_BenchGpioCases[0]); _Index++)
+      {
+            _Base=Sim_BenchRun(Sim_BenchGpioCases[_Index].name,"device",Sim_BenchGpioCases[_Index].legacy,0);
+            if(Sim_BenchGpioCases[_Index].handle != NULL_PTR)
+                  Sim_BenchRun(Sim_BenchGpioCases[_Index].name,"handle",Sim_BenchGpioCases[_Index].handle,_Base);
+            Sim_BenchRun(Sim_BenchGpioCases[_Index].name,"static",Sim_BenchGpioCases[_Index].fast,_Base);
+      }
+      printf("  code size: make -C Host sizes\n");
+}
+
+void Sim_BenchTime(void)
+{
+      static const struct{
+              const char * name;
+              void (*call)(void);
+      }_Paths[]={
+              {"binary",Sim_BenchTimeBinary},
+              {"bcd",   Sim_BenchTimeBcd}
+      };
+      uint8  _Index;
+      uint8  _Repeat;
+      uint32 _Second;
+      double _Start;
+      double _Time;
+      double _Elapsed;
+
+      Sim_Reset();
+      LcdBuffer_init();
+      printf("  per second-tick (decrement and rendering to the LCD buffer), best of %u x %lu\n",
+             SIM_BENCH_REPEAT,SIM_BENCH_SECONDS);
+      for(_Index=0; _Index<sizeof(_Paths)/sizeof(_Paths[0]); _Index++)
+      {
+            _Elapsed=0;
+            for(_Repeat=0; _Repeat<SIM_BENCH_REPEAT; _Repeat++)
+            {
+                  /* Count 99:59:59 down (wraps in the binary path) */
+                  Sim_BenchBinaryTime.hours=99;
+                  Sim_BenchBinaryTime.minutes=59;
+                  Sim_BenchBinaryTime.seconds=59;
+                  Sim_BenchBcdTime.hours=0x99;
+                  Sim_BenchBcdTime.minutes=0x59;
+                  Sim_BenchBcdTime.seconds=0x59;
+                  Sim_BenchDivisions=0;
+                  _Start=Sim_BenchNowNs();
+                  for(_Second=0; _Second<SIM_BENCH_SECONDS; _Second++) _Paths[_Index].call();
+                  _Time=(Sim_BenchNowNs()-_Start)/SIM_BENCH_SECONDS;
+                  if(_Repeat==0 || _Time<_Elapsed) _Elapsed=_Time;
+            }
+            printf("  %-7s %5.2f divisions %8.1f ns\n",_Paths[_Index].name,
+                   (double)Sim_BenchDivisions/SIM_BENCH_SECONDS,_Elapsed);
+      }
+      printf("  host time, the divisions run the 8 bits shift-subtract loop of a PIC18\n");
+}
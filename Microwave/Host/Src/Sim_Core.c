@@ -0,0 +1,1108 @@
+/*****************************************************************************/
+/** File:    Sim_Core.c                                                     **/
+/**                                                                         **/
+/** Description: This file is the implementation of the host simulator of  **/
+/**              PIC18F4620 used by the Linux build of the firmware.        **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "Sim_Core.h"
+
+/* Local Macros */
+#define SIM_PORT_LATCH_OFFSET     0x09   /* PORTx => LATx */
+#define SIM_PORT_DIRECTION_OFFSET 0x12   /* PORTx => TRISx */
+
+#define SIM_GIE     7
+#define SIM_PEIE    6
+#define SIM_TMR0IF  2
+#define SIM_INT0IF  1
+#define SIM_RBIF    0
+#define SIM_INT1IF  0
+#define SIM_INT2IF  1
+#define SIM_IPEN    7   /* RCON */
+#define SIM_TMR0IP  2   /* INTCON2, TMR0IF and RBIF bits */
+#define SIM_RBIP    0
+#define SIM_INT1IP  6   /* INTCON3, INT2IP above it */
+#define SIM_INT_ROWS 4  /* INTCON, INTCON3, PIR1, PIR2 */
+
+#define SIM_INTEDG0 6
+#define SIM_INTEDG1 5
+#define SIM_INTEDG2 4
+
+#define SIM_IDLEN   7   /* OSCCON */
+
+#define SIM_TMR0ON  7
+#define SIM_T08BIT  6
+#define SIM_T0CS    5
+#define SIM_PSA     3
+
+#define SIM_TMR1ON  0   /* Same bits in T3CON (TMR3ON, TMR3CS) */
+#define SIM_TMR1CS  1
+#define SIM_T1OSCEN 3
+#define SIM_RD16    7
+
+#define SIM_TMR2ON  2
+
+#define SIM_TMR1IF  0
+#define SIM_TMR2IF  1
+#define SIM_TMR3IF  1
+
+#define SIM_KEYPAD_MAX 4
+
+/* Local data types */
+typedef enum{
+        SIM_EVENT_INPUT=0,
+        SIM_EVENT_KEY  =1,
+        SIM_EVENT_PROBE=2
+}Sim_EventKindType;
+
+/* Timer1 and Timer3 are the same 16 bits timer, both can count T1OSC */
+typedef struct{
+        uint16 conAddress;   /* T1CON / T3CON */
+        uint16 lowAddress;   /* TMR1L / TMR3L */
+        uint16 highAddress;  /* TMR1H / TMR3H */
+        uint16 pirAddress;   /* PIR1 / PIR2 */
+        uint8  flag;         /* TMR1IF / TMR3IF */
+        uint16 count;        /* Counter */
+        uint8  highBuffer;   /* TMRxH buffer register (RD16 set) */
+        uint8  prescaler;    /* Prescaler counter */
+}Sim_Timer13Type;
+
+typedef struct{
+        uint64            cycle;
+        Sim_EventKindType kind;
+        uint8             a;       /* port or row */
+        uint8             b;       /* pin or col */
+        uint8             level;   /* level or key down */
+        void            (*probe)(void);
+}Sim_EventType;
+
+/* Global variables */
+uint8 Sim_Memory[SIM_MEMORY_SIZE];
+Sim_StatsType Sim_Stats;
+
+/* Private variables */
+static uint32 Sim_ReadCount[SIM_MEMORY_SIZE];
+static uint32 Sim_WriteCount[SIM_MEMORY_SIZE];
+
+static uint8  Sim_InputLevel[SIM_NUMBER_OF_PORTS];  /* External pin levels */
+static uint8  Sim_PortBLevel;                       /* Last computed RB levels */
+static uint8  Sim_PortBRead;                        /* RB levels at last read */
+
+static uint16 Sim_Tmr0;           /* Timer0 counter */
+static uint8  Sim_Tmr0HighBuffer; /* TMR0H buffer register */
+static uint16 Sim_Tmr0Prescaler;  /* Prescaler counter */
+static uint8  Sim_Tmr0Inhibit;    /* Increment inhibit after write */
+
+static Sim_Timer13Type Sim_Timer1={SIM_T1CON_ADDRESS,SIM_TMR1L_ADDRESS,
+        SIM_TMR1H_ADDRESS,SIM_PIR1_ADDRESS,SIM_TMR1IF};
+static Sim_Timer13Type Sim_Timer3={SIM_T3CON_ADDRESS,SIM_TMR3L_ADDRESS,
+        SIM_TMR3H_ADDRESS,SIM_PIR2_ADDRESS,SIM_TMR3IF};
+static uint32 Sim_T1OscPhase;     /* T1OSC phase, SIM_T1OSC_HZ per Tcy */
+
+static uint8  Sim_Tmr2;           /* Timer2 counter */
+static uint8  Sim_Tmr2Prescaler;  /* Prescaler counter */
+static uint8  Sim_Tmr2Postscaler; /* Matches counted by the postscaler */
+
+static void (*Sim_LatchHook)(uint8 port, uint8 latch);
+static void (*Sim_SleepHook)(void);
+
+static uint8  Sim_KeypadRows;
+static uint8  Sim_KeypadCols;
+static uint8  Sim_KeypadRowPort[SIM_KEYPAD_MAX];
+static uint8  Sim_KeypadRowPin[SIM_KEYPAD_MAX];
+static uint8  Sim_KeypadColPort[SIM_KEYPAD_MAX];
+static uint8  Sim_KeypadColPin[SIM_KEYPAD_MAX];
+static uint8  Sim_KeyDown[SIM_KEYPAD_MAX][SIM_KEYPAD_MAX];
+
+static Sim_EventType Sim_Events[SIM_MAX_EVENTS];
+static uint8  Sim_EventsNumber;
+
+static uint8  Sim_InIsr;          /* High priority routine, the only one without IPEN */
+static uint8  Sim_InIsrLow;       /* Low priority routine, a high one may be nested */
+static uint8  Sim_Asleep;         /* Sim_Sleep is waiting for a wakeup */
+static uint8  Sim_PendingBits[SIM_INT_ROWS];      /* Pending at the last step */
+static uint64 Sim_PendingSince[SIM_INT_ROWS][8];  /* Cycle each one got pending */
+static uint32 Sim_LatencyMaxOf[SIM_INT_ROWS][8];  /* Per source */
+static uint8  Sim_Running;
+static uint64 Sim_EndCycle;
+static jmp_buf Sim_ExitPoint;
+
+/* Registers names for the reports */
+static const struct{
+        uint16       address;
+        const char * name;
+}Sim_Names[]={
+        {0x0F80,"PORTA"},  {0x0F81,"PORTB"},  {0x0F82,"PORTC"},
+        {0x0F83,"PORTD"},  {0x0F84,"PORTE"},  {0x0F89,"LATA"},
+        {0x0F8A,"LATB"},   {0x0F8B,"LATC"},   {0x0F8C,"LATD"},
+        {0x0F8D,"LATE"},   {0x0F92,"TRISA"},  {0x0F93,"TRISB"},
+        {0x0F94,"TRISC"},  {0x0F95,"TRISD"},  {0x0F96,"TRISE"},
+        {0x0F9D,"PIE1"},   {0x0F9E,"PIR1"},   {0x0F9F,"IPR1"},
+        {0x0FA0,"PIE2"},   {0x0FA1,"PIR2"},   {0x0FA2,"IPR2"},
+        {0x0FB1,"T3CON"},  {0x0FB2,"TMR3L"},  {0x0FB3,"TMR3H"},
+        {0x0FC1,"ADCON1"}, {0x0FCA,"T2CON"},  {0x0FCB,"PR2"},
+        {0x0FCC,"TMR2"},   {0x0FCD,"T1CON"},  {0x0FCE,"TMR1L"},
+        {0x0FCF,"TMR1H"},  {0x0FD0,"RCON"},   {0x0FD3,"OSCCON"},
+        {0x0FD5,"T0CON"},  {0x0FD6,"TMR0L"},  {0x0FD7,"TMR0H"},
+        {0x0FF0,"INTCON3"},{0x0FF1,"INTCON2"},{0x0FF2,"INTCON"}
+};
+
+/* Private functions prototype */
+static uint8  Sim_PortIndex(uint16 address, uint16 base);
+static uint8  Sim_PortPins(uint8 port);
+static void   Sim_UpdatePins(void);
+static uint8  Sim_Peek(uint16 address);
+static void   Sim_Poke(uint16 address, uint8 value);
+static uint32 Sim_Timer0Prescaler(void);
+static uint8  Sim_Timer0Running(void);
+static uint64 Sim_Timer0CyclesToOverflow(void);
+static void   Sim_Timer0Advance(uint64 cycles);
+static Sim_Timer13Type * Sim_Timer13Of(uint16 address);
+static uint8  Sim_Timer13Running(Sim_Timer13Type * timer);
+static uint8  Sim_Timer13Crystal(Sim_Timer13Type * timer);
+static uint64 Sim_Timer13CyclesToOverflow(Sim_Timer13Type * timer);
+static uint32 Sim_Timer13Advance(Sim_Timer13Type * timer, uint64 cycles);
+static uint8  Sim_Timer2Running(void);
+static uint32 Sim_Timer2Prescaler(void);
+static uint64 Sim_Timer2CyclesToFlag(void);
+static void   Sim_Timer2Advance(uint64 cycles);
+static uint64 Sim_CyclesToTimerFlag(void);
+static uint8  Sim_MainClockStopped(void);
+static Sim_EventType * Sim_ScheduleEvent(uint64 cycle, Sim_EventKindType kind,
+                                         uint8 a, uint8 b, uint8 level);
+static void   Sim_ApplyDueEvents(void);
+static void   Sim_PendingSources(uint8 * pending);
+static void   Sim_HighSources(uint8 * high);
+static void   Sim_TrackPending(void);
+static uint8  Sim_InterruptRequested(void);
+static uint8  Sim_VectorRequested(uint8 high);
+static void   Sim_TakeLatency(uint8 high);
+static void   Sim_Interrupt(uint8 high);
+static void   Sim_ServiceInterrupts(void);
+
+/* Private functions defination */
+static uint8 Sim_PortIndex(uint16 address, uint16 base)
+{
+      if(address >= base && address < base+SIM_NUMBER_OF_PORTS)
+      {
+            return (uint8)(address-base);
+      }
+      return SIM_NUMBER_OF_PORTS; /* Not a port register */
+}
+
+/* Level of all pins of a port: outputs from LAT, inputs from outside */
+static uint8 Sim_PortPins(uint8 port)
+{
+      uint8 _Input=Sim_InputLevel[port];
+      uint8 _Tris =Sim_Memory[SIM_TRISA_ADDRESS+port];
+      uint8 _Lat  =Sim_Memory[SIM_LATA_ADDRESS+port];
+      uint8 _Row;
+      uint8 _Col;
+      uint8 _RowLevel;
+
+      /* A pressed key pulls its column down while its row is driven LOW */
+      for(_Row=0; _Row<Sim_KeypadRows; _Row++)
+      {
+            _RowLevel=1;
+            if(!(Sim_Memory[SIM_TRISA_ADDRESS+Sim_KeypadRowPort[_Row]] & (1<<Sim_KeypadRowPin[_Row])))
+            {
+                  _RowLevel=(Sim_Memory[SIM_LATA_ADDRESS+Sim_KeypadRowPort[_Row]] >> Sim_KeypadRowPin[_Row]) & 1;
+            }
+            for(_Col=0; _Col<Sim_KeypadCols; _Col++)
+            {
+                  if(Sim_KeyDown[_Row][_Col] && _RowLevel==0 && Sim_KeypadColPort[_Col]==port)
+                  {
+                        _Input &=~ (1<<Sim_KeypadColPin[_Col]);
+                  }
+            }
+      }
+      return (uint8)((_Lat & ~_Tris) | (_Input & _Tris));
+}
+
+/* Edge detection of INT0..INT2 and RB7:RB4 change after any pin change */
+static void Sim_UpdatePins(void)
+{
+      uint8 _New=Sim_PortPins(SIM_PORTB);
+      uint8 _Old=Sim_PortBLevel;
+      uint8 _Edge=Sim_Memory[SIM_INTCON2_ADDRESS];
+      uint8 _Rising =(uint8)(~_Old & _New);
+      uint8 _Falling=(uint8)(_Old & ~_New);
+
+      if(((_Edge & (1<<SIM_INTEDG0)) ? _Rising : _Falling) & (1<<0))
+            Sim_Memory[SIM_INTCON_ADDRESS] |= (1<<SIM_INT0IF);
+      if(((_Edge & (1<<SIM_INTEDG1)) ? _Rising : _Falling) & (1<<1))
+            Sim_Memory[SIM_INTCON3_ADDRESS] |= (1<<SIM_INT1IF);
+      if(((_Edge & (1<<SIM_INTEDG2)) ? _Rising : _Falling) & (1<<2))
+            Sim_Memory[SIM_INTCON3_ADDRESS] |= (1<<SIM_INT2IF);
+
+      /* Mismatch of input RB7:RB4 against the last read of PORTB */
+      if((_New ^ Sim_PortBRead) & Sim_Memory[SIM_TRISA_ADDRESS+SIM_PORTB] & 0xF0)
+            Sim_Memory[SIM_INTCON_ADDRESS] |= (1<<SIM_RBIF);
+
+      Sim_PortBLevel=_New;
+}
+
+static uint8 Sim_Peek(uint16 address)
+{
+      uint8 _Port=Sim_PortIndex(address,SIM_PORTA_ADDRESS);
+      Sim_Timer13Type * _Timer13=Sim_Timer13Of(address);
+
+      if(_Port < SIM_NUMBER_OF_PORTS)
+      {
+            uint8 _Value=Sim_PortPins(_Port);
+            if(_Port==SIM_PORTB) Sim_PortBRead=_Value; /* Ends mismatch */
+            return _Value;
+      }
+      if(address==SIM_TMR0L_ADDRESS)
+      {
+            Sim_Tmr0HighBuffer=(uint8)(Sim_Tmr0>>8); /* TMR0H latched */
+            return (uint8)Sim_Tmr0;
+      }
+      if(address==SIM_TMR0H_ADDRESS)
+      {
+            return Sim_Tmr0HighBuffer;
+      }
+      if(_Timer13!=NULL_PTR && address==_Timer13->lowAddress)
+      {
+            _Timer13->highBuffer=(uint8)(_Timer13->count>>8); /* TMRxH latched */
+            return (uint8)_Timer13->count;
+      }
+      if(_Timer13!=NULL_PTR && address==_Timer13->highAddress)
+      {
+            if(Sim_Memory[_Timer13->conAddress] & (1<<SIM_RD16))
+                  return _Timer13->highBuffer;
+            return (uint8)(_Timer13->count>>8);
+      }
+      if(address==SIM_TMR2_ADDRESS)
+      {
+            return Sim_Tmr2;
+      }
+      return Sim_Memory[address];
+}
+
+static void Sim_Poke(uint16 address, uint8 value)
+{
+      uint8 _Port=Sim_PortIndex(address,SIM_PORTA_ADDRESS);
+      Sim_Timer13Type * _Timer13=Sim_Timer13Of(address);
+
+      if(_Port < SIM_NUMBER_OF_PORTS) /* Writing PORTx writes LATx */
+      {
+            address+=SIM_PORT_LATCH_OFFSET;
+      }
+      if(address==SIM_TMR0H_ADDRESS)
+      {
+            Sim_Tmr0HighBuffer=value;
+            return;
+      }
+      if(address==SIM_TMR0L_ADDRESS)
+      {
+            if(Sim_Memory[SIM_T0CON_ADDRESS] & (1<<SIM_T08BIT))
+                  Sim_Tmr0=value;
+            else
+                  Sim_Tmr0=(uint16)((Sim_Tmr0HighBuffer<<8) | value);
+            Sim_Tmr0Prescaler=0; /* Writing TMR0 clears the prescaler */
+            Sim_Tmr0Inhibit=2;   /* and inhibits increment for 2 Tcy */
+            return;
+      }
+      if(_Timer13!=NULL_PTR && address!=_Timer13->conAddress)
+      {
+            uint8 _Rd16=Sim_Memory[_Timer13->conAddress] & (1<<SIM_RD16);
+
+            if(address==_Timer13->highAddress && _Rd16)
+            {
+                  _Timer13->highBuffer=value;  /* Loaded by the TMRxL write */
+                  return;
+            }
+            if(address==_Timer13->highAddress)
+                  _Timer13->count=(uint16)((value<<8) | (_Timer13->count & 0xFF));
+            else if(_Rd16)
+                  _Timer13->count=(uint16)((_Timer13->highBuffer<<8) | value);
+            else
+                  _Timer13->count=(uint16)((_Timer13->count & 0xFF00) | value);
+            _Timer13->prescaler=0; /* Writing TMRx clears the prescaler, */
+            return;                /* the crystal phase goes on          */
+      }
+      if(address==SIM_TMR2_ADDRESS || address==SIM_T2CON_ADDRESS)
+      {
+            if(address==SIM_TMR2_ADDRESS) Sim_Tmr2=value;
+            else                          Sim_Memory[address]=value;
+            Sim_Tmr2Prescaler=0;  /* Both writes clear the prescaler */
+            Sim_Tmr2Postscaler=0; /* and the postscaler */
+            return;
+      }
+      Sim_Memory[address]=value;
+      if(Sim_PortIndex(address,SIM_LATA_ADDRESS)  < SIM_NUMBER_OF_PORTS ||
+         Sim_PortIndex(address,SIM_TRISA_ADDRESS) < SIM_NUMBER_OF_PORTS)
+      {
+            Sim_UpdatePins();
+      }
+      _Port=Sim_PortIndex(address,SIM_LATA_ADDRESS);
+      if(_Port < SIM_NUMBER_OF_PORTS && Sim_LatchHook)
+      {
+            Sim_LatchHook(_Port,value);
+      }
+}
+
+static uint32 Sim_Timer0Prescaler(void)
+{
+      uint8 _T0con=Sim_Memory[SIM_T0CON_ADDRESS];
+
+      if(_T0con & (1<<SIM_PSA)) return 1;
+      return 2UL << (_T0con & 0x07);
+}
+
+static uint8 Sim_Timer0Running(void)
+{
+      uint8 _T0con=Sim_Memory[SIM_T0CON_ADDRESS];
+
+      /* T0CKI has nothing connected, only the internal clock counts */
+      return (_T0con & (1<<SIM_TMR0ON)) && !(_T0con & (1<<SIM_T0CS)) &&
+             !Sim_MainClockStopped();
+}
+
+static uint64 Sim_Timer0CyclesToOverflow(void)
+{
+      uint32 _Top;
+
+      if(!Sim_Timer0Running()) return 0;
+      _Top=(Sim_Memory[SIM_T0CON_ADDRESS] & (1<<SIM_T08BIT)) ? 0x100UL : 0x10000UL;
+      return Sim_Tmr0Inhibit + (uint64)(_Top-Sim_Tmr0)*Sim_Timer0Prescaler() - Sim_Tmr0Prescaler;
+}
+
+static void Sim_Timer0Advance(uint64 cycles)
+{
+      uint32 _Top;
+      uint32 _Scale;
+      uint64 _Total;
+      uint64 _Overflow=Sim_Timer0CyclesToOverflow();
+
+      if(!Sim_Timer0Running()) return;
+      if(Sim_Tmr0Inhibit)
+      {
+            if(cycles <= Sim_Tmr0Inhibit)
+            {
+                  Sim_Tmr0Inhibit-=(uint8)cycles;
+                  return;
+            }
+            cycles-=Sim_Tmr0Inhibit;
+            Sim_Tmr0Inhibit=0;
+      }
+      _Top  =(Sim_Memory[SIM_T0CON_ADDRESS] & (1<<SIM_T08BIT)) ? 0x100UL : 0x10000UL;
+      _Scale=Sim_Timer0Prescaler();
+      _Total=Sim_Tmr0Prescaler+cycles;
+      Sim_Tmr0Prescaler=(uint16)(_Total%_Scale);
+      _Total=Sim_Tmr0+_Total/_Scale;
+      if(_Total >= _Top)
+      {
+            Sim_Memory[SIM_INTCON_ADDRESS] |= (1<<SIM_TMR0IF);
+            Sim_Stats.timer0Overflows++;
+            Sim_Stats.timer0OverflowCycle=Sim_Stats.cycles+_Overflow;
+      }
+      Sim_Tmr0=(uint16)(_Total%_Top);
+}
+
+static Sim_Timer13Type * Sim_Timer13Of(uint16 address)
+{
+      if(address==SIM_T1CON_ADDRESS || address==SIM_TMR1L_ADDRESS ||
+         address==SIM_TMR1H_ADDRESS) return &Sim_Timer1;
+      if(address==SIM_T3CON_ADDRESS || address==SIM_TMR3L_ADDRESS ||
+         address==SIM_TMR3H_ADDRESS) return &Sim_Timer3;
+      return NULL_PTR;
+}
+
+static uint8 Sim_Timer13Running(Sim_Timer13Type * timer)
+{
+      uint8 _Con=Sim_Memory[timer->conAddress];
+
+      /* T13CKI has nothing connected, the internal clock or T1OSC count */
+      if(!(_Con & (1<<SIM_TMR1ON))) return FALSE;
+      if(_Con & (1<<SIM_TMR1CS)) return Sim_Timer13Crystal(timer);
+      return !Sim_MainClockStopped();
+}
+
+/* On the 32.768 kHz crystal of Timer1: counts without the main oscillator */
+static uint8 Sim_Timer13Crystal(Sim_Timer13Type * timer)
+{
+      return (Sim_Memory[timer->conAddress] & (1<<SIM_TMR1CS)) &&
+             (Sim_Memory[SIM_T1CON_ADDRESS] & (1<<SIM_T1OSCEN));
+}
+
+static uint64 Sim_Timer13CyclesToOverflow(Sim_Timer13Type * timer)
+{
+      uint32 _Scale=1UL << ((Sim_Memory[timer->conAddress]>>4) & 0x03);
+      uint64 _Clocks;
+      uint64 _Den;
+
+      if(!Sim_Timer13Running(timer)) return 0;
+      _Clocks=(uint64)(0x10000UL-timer->count)*_Scale-timer->prescaler;
+      if(!Sim_Timer13Crystal(timer)) return _Clocks;
+      /* First cycle where the crystal phase reaches the clocks */
+      _Den=SIM_FOSC_HZ/4;
+      return (_Clocks*_Den-Sim_T1OscPhase+SIM_T1OSC_HZ-1)/SIM_T1OSC_HZ;
+}
+
+/* Returns 1 on an overflow, the crystal phase is moved on by the caller */
+static uint32 Sim_Timer13Advance(Sim_Timer13Type * timer, uint64 cycles)
+{
+      uint32 _Scale=1UL << ((Sim_Memory[timer->conAddress]>>4) & 0x03);
+      uint64 _Total;
+
+      if(!Sim_Timer13Running(timer)) return 0;
+      _Total=cycles;
+      if(Sim_Timer13Crystal(timer))
+      {
+            _Total=(Sim_T1OscPhase+cycles*SIM_T1OSC_HZ)/(SIM_FOSC_HZ/4);
+      }
+      _Total+=timer->prescaler;
+      timer->prescaler=(uint8)(_Total%_Scale);
+      _Total=timer->count+_Total/_Scale;
+      timer->count=(uint16)(_Total%0x10000UL);
+      if(_Total < 0x10000UL) return 0;
+      Sim_Memory[timer->pirAddress] |= (1<<timer->flag);
+      return 1;
+}
+
+static uint8 Sim_Timer2Running(void)
+{
+      return (Sim_Memory[SIM_T2CON_ADDRESS] & (1<<SIM_TMR2ON)) && !Sim_MainClockStopped();
+}
+
+static uint32 Sim_Timer2Prescaler(void)
+{
+      uint8 _Ckps=Sim_Memory[SIM_T2CON_ADDRESS] & 0x03;
+
+      return (_Ckps==0) ? 1 : ((_Ckps==1) ? 4 : 16);
+}
+
+/* TMR2 counts up to PR2 and resets, every reset is a match for the postscaler */
+static uint64 Sim_Timer2CyclesToFlag(void)
+{
+      uint32 _Period=(uint32)Sim_Memory[SIM_PR2_ADDRESS]+1;
+      uint32 _Postscale=((Sim_Memory[SIM_T2CON_ADDRESS]>>3) & 0x0F)+1;
+      uint32 _Ticks;
+
+      if(!Sim_Timer2Running()) return 0;
+      _Ticks=(Sim_Tmr2 <= Sim_Memory[SIM_PR2_ADDRESS]) ? _Period-Sim_Tmr2 : 0x100UL-Sim_Tmr2+_Period;
+      _Ticks+=(_Postscale-1-Sim_Tmr2Postscaler)*_Period;
+      return (uint64)_Ticks*Sim_Timer2Prescaler()-Sim_Tmr2Prescaler;
+}
+
+static void Sim_Timer2Advance(uint64 cycles)
+{
+      uint32 _Period=(uint32)Sim_Memory[SIM_PR2_ADDRESS]+1;
+      uint32 _Postscale=((Sim_Memory[SIM_T2CON_ADDRESS]>>3) & 0x0F)+1;
+      uint32 _Scale;
+      uint64 _Ticks;
+      uint64 _ToReset;
+      uint64 _Matches;
+
+      if(!Sim_Timer2Running()) return;
+      _Scale=Sim_Timer2Prescaler();
+      _Ticks=Sim_Tmr2Prescaler+cycles;
+      Sim_Tmr2Prescaler=(uint8)(_Ticks%_Scale);
+      _Ticks/=_Scale;
+      _ToReset=(Sim_Tmr2 <= Sim_Memory[SIM_PR2_ADDRESS]) ? _Period-Sim_Tmr2 : 0x100UL-Sim_Tmr2+_Period;
+      if(_Ticks < _ToReset)
+      {
+            Sim_Tmr2=(uint8)(Sim_Tmr2+_Ticks);
+            return;
+      }
+      _Ticks-=_ToReset;
+      _Matches=1+_Ticks/_Period;
+      Sim_Tmr2=(uint8)(_Ticks%_Period);
+      if(Sim_Tmr2Postscaler+_Matches >= _Postscale)
+      {
+            Sim_Memory[SIM_PIR1_ADDRESS] |= (1<<SIM_TMR2IF);
+      }
+      Sim_Tmr2Postscaler=(uint8)((Sim_Tmr2Postscaler+_Matches)%_Postscale);
+}
+
+/* Cycles to the next flag of a running timer, 0 if no timer runs */
+static uint64 Sim_CyclesToTimerFlag(void)
+{
+      uint64 _Next=Sim_Timer0CyclesToOverflow();
+      uint64 _Timer=Sim_Timer13CyclesToOverflow(&Sim_Timer1);
+
+      if(_Next==0 || (_Timer!=0 && _Timer<_Next)) _Next=_Timer;
+      _Timer=Sim_Timer13CyclesToOverflow(&Sim_Timer3);
+      if(_Next==0 || (_Timer!=0 && _Timer<_Next)) _Next=_Timer;
+      _Timer=Sim_Timer2CyclesToFlag();
+      if(_Next==0 || (_Timer!=0 && _Timer<_Next)) _Next=_Timer;
+      return _Next;
+}
+
+/* SLEEP with OSCCON.IDLEN clear stops the main oscillator: the timers on */
+/* Tcy freeze, only the Timer1 crystal and the inputs go on. With IDLEN   */
+/* set (idle) the peripherals keep their clock.                           */
+static uint8 Sim_MainClockStopped(void)
+{
+      return Sim_Asleep && !(Sim_Memory[SIM_OSCCON_ADDRESS] & (1<<SIM_IDLEN));
+}
+
+static Sim_EventType * Sim_ScheduleEvent(uint64 cycle, Sim_EventKindType kind,
+                                         uint8 a, uint8 b, uint8 level)
+{
+      static Sim_EventType _Dropped;
+      uint8 _Index;
+
+      if(Sim_EventsNumber >= SIM_MAX_EVENTS)
+      {
+            printf("sim: event queue full\n");
+            return &_Dropped;
+      }
+      /* Keep the queue sorted by time, same time keeps insertion order */
+      _Index=Sim_EventsNumber;
+      while(_Index>0 && Sim_Events[_Index-1].cycle > cycle)
+      {
+            Sim_Events[_Index]=Sim_Events[_Index-1];
+            _Index--;
+      }
+      Sim_Events[_Index].cycle=cycle;
+      Sim_Events[_Index].kind=kind;
+      Sim_Events[_Index].a=a;
+      Sim_Events[_Index].b=b;
+      Sim_Events[_Index].level=level;
+      Sim_Events[_Index].probe=NULL_PTR;
+      Sim_EventsNumber++;
+      return &Sim_Events[_Index];
+}
+
+static void Sim_ApplyDueEvents(void)
+{
+      while(Sim_EventsNumber>0 && Sim_Events[0].cycle <= Sim_Stats.cycles)
+      {
+            Sim_EventType _Event=Sim_Events[0];
+            memmove(&Sim_Events[0],&Sim_Events[1],(Sim_EventsNumber-1)*sizeof(Sim_EventType));
+            Sim_EventsNumber--;
+            if(_Event.kind==SIM_EVENT_INPUT)
+                  Sim_SetInput(_Event.a,_Event.b,_Event.level);
+            else if(_Event.kind==SIM_EVENT_KEY)
+                  Sim_SetKey(_Event.a,_Event.b,_Event.level);
+            else
+                  _Event.probe();
+      }
+}
+
+/* Flags with their enable bit set, one row per flag register in flag bit */
+/* positions (GIE and PEIE not considered)                                */
+static void Sim_PendingSources(uint8 * pending)
+{
+      uint8 _Intcon =Sim_Memory[SIM_INTCON_ADDRESS];
+      uint8 _Intcon3=Sim_Memory[SIM_INTCON3_ADDRESS];
+
+      pending[0]=_Intcon  & (_Intcon>>3)  & 0x07;
+      pending[1]=_Intcon3 & (_Intcon3>>3) & 0x03;
+      pending[2]=Sim_Memory[SIM_PIR1_ADDRESS] & Sim_Memory[SIM_PIE1_ADDRESS];
+      pending[3]=Sim_Memory[SIM_PIR2_ADDRESS] & Sim_Memory[SIM_PIE2_ADDRESS];
+}
+
+/* Sources on high priority in the same positions, all while IPEN is clear */
+/* (INT0 has no priority bit, always high)                                */
+static void Sim_HighSources(uint8 * high)
+{
+      if(!(Sim_Memory[SIM_RCON_ADDRESS] & (1<<SIM_IPEN)))
+      {
+            memset(high,0xFF,SIM_INT_ROWS);
+            return;
+      }
+      high[0]=(1<<SIM_INT0IF) | (Sim_Memory[SIM_INTCON2_ADDRESS] & ((1<<SIM_TMR0IP)|(1<<SIM_RBIP)));
+      high[1]=(Sim_Memory[SIM_INTCON3_ADDRESS]>>SIM_INT1IP) & 0x03;
+      high[2]=Sim_Memory[SIM_IPR1_ADDRESS];
+      high[3]=Sim_Memory[SIM_IPR2_ADDRESS];
+}
+
+/* Stamp the sources which got pending, the steps of Sim_Advance end at */
+/* every timer flag and input event so the stamp is their cycle         */
+static void Sim_TrackPending(void)
+{
+      uint8 _Pending[SIM_INT_ROWS];
+      uint8 _New;
+      uint8 _Row;
+      uint8 _Bit;
+
+      Sim_PendingSources(_Pending);
+      for(_Row=0; _Row<SIM_INT_ROWS; _Row++)
+      {
+            _New=_Pending[_Row] & ~Sim_PendingBits[_Row];
+            for(_Bit=0; _New!=0; _Bit++, _New>>=1)
+            {
+                  if(_New & 1) Sim_PendingSince[_Row][_Bit]=Sim_Stats.cycles;
+            }
+            Sim_PendingBits[_Row]=_Pending[_Row];
+      }
+}
+
+/* Interrupt flag with its enable bit set: wakes from SLEEP, GIE and PEIE */
+/* only decide if it vectors                                             */
+static uint8 Sim_InterruptRequested(void)
+{
+      uint8 _Pending[SIM_INT_ROWS];
+
+      Sim_PendingSources(_Pending);
+      return (_Pending[0] | _Pending[1] | _Pending[2] | _Pending[3]) != 0;
+}
+
+/* A pending source of one vector. Peripherals need PEIE (GIEL), but the */
+/* high priority ones with IPEN. GIE (GIEH) is checked by the caller.   */
+static uint8 Sim_VectorRequested(uint8 high)
+{
+      uint8 _Pending[SIM_INT_ROWS];
+      uint8 _High[SIM_INT_ROWS];
+      uint8 _Peripherals=(Sim_Memory[SIM_INTCON_ADDRESS] & (1<<SIM_PEIE))
+                         || (high && (Sim_Memory[SIM_RCON_ADDRESS] & (1<<SIM_IPEN)));
+      uint8 _Row;
+
+      Sim_PendingSources(_Pending);
+      Sim_HighSources(_High);
+      for(_Row=0; _Row<SIM_INT_ROWS; _Row++)
+      {
+            if(_Row >= 2 && !_Peripherals) break;
+            if(_Pending[_Row] & (high ? _High[_Row] : (uint8)~_High[_Row])) return TRUE;
+      }
+      return FALSE;
+}
+
+/* Cycles from each pending source of the vector getting pending to now */
+static void Sim_TakeLatency(uint8 high)
+{
+      uint8  _High[SIM_INT_ROWS];
+      uint8  _Bits;
+      uint8  _Row;
+      uint8  _Bit;
+      uint32 _Latency;
+      uint32 * _Max=high ? &Sim_Stats.highLatencyMax : &Sim_Stats.lowLatencyMax;
+
+      Sim_HighSources(_High);
+      for(_Row=0; _Row<SIM_INT_ROWS; _Row++)
+      {
+            _Bits=Sim_PendingBits[_Row] & (high ? _High[_Row] : (uint8)~_High[_Row]);
+            for(_Bit=0; _Bits!=0; _Bit++, _Bits>>=1)
+            {
+                  if(!(_Bits & 1)) continue;
+                  _Latency=(uint32)(Sim_Stats.cycles-Sim_PendingSince[_Row][_Bit]);
+                  if(_Latency > Sim_LatencyMaxOf[_Row][_Bit]) Sim_LatencyMaxOf[_Row][_Bit]=_Latency;
+                  if(_Latency > *_Max)                        *_Max=_Latency;
+            }
+      }
+}
+
+/* Vectoring clears GIEH (GIE) or GIEL until the retfie, a high routine */
+/* nested in the low one is counted in its time                         */
+static void Sim_Interrupt(uint8 high)
+{
+      uint8  _Enable=high ? SIM_GIE : SIM_PEIE;
+      uint8  _Nested=Sim_InIsrLow;
+      uint64 _Start=Sim_Stats.cycles;
+
+      if(high) Sim_InIsr=TRUE;
+      else     Sim_InIsrLow=TRUE;
+      Sim_Memory[SIM_INTCON_ADDRESS] &=~ (1<<_Enable);
+      Sim_Stats.interrupts++;
+      if(!high) Sim_Stats.lowInterrupts++;
+      Sim_Advance(SIM_ISR_ENTRY_CYCLES);
+      Sim_TakeLatency(high);
+      if(high) interrupt();
+      else     interrupt_low();
+      Sim_Memory[SIM_INTCON_ADDRESS] |= (1<<_Enable);  /* retfie */
+      if(high) Sim_InIsr=FALSE;
+      else     Sim_InIsrLow=FALSE;
+      if(!(high && _Nested)) Sim_Stats.isrCycles+=Sim_Stats.cycles-_Start;
+}
+
+static void Sim_ServiceInterrupts(void)
+{
+      uint8 _Intcon=Sim_Memory[SIM_INTCON_ADDRESS];
+
+      if(Sim_InIsr) return;  /* The high priority routine isn't interrupted */
+      if(!(_Intcon & (1<<SIM_GIE))) return;  /* GIEH masks both with IPEN */
+      if(Sim_VectorRequested(TRUE))
+      {
+            Sim_Interrupt(TRUE);
+      }
+      else if((Sim_Memory[SIM_RCON_ADDRESS] & (1<<SIM_IPEN)) && !Sim_InIsrLow
+              && (_Intcon & (1<<SIM_PEIE)) && Sim_VectorRequested(FALSE))
+      {
+            Sim_Interrupt(FALSE);
+      }
+}
+
+/* Public functions defination */
+void Sim_Reset(void)
+{
+      memset(Sim_Memory,0,sizeof(Sim_Memory));
+      Sim_ResetCounters();
+      memset(&Sim_Stats,0,sizeof(Sim_Stats));
+      memset(Sim_InputLevel,0xFF,sizeof(Sim_InputLevel)); /* Pulled up */
+      memset(Sim_KeyDown,0,sizeof(Sim_KeyDown));
+
+      /* Power on reset values */
+      Sim_Memory[SIM_TRISA_ADDRESS+0]=0xFF;
+      Sim_Memory[SIM_TRISA_ADDRESS+1]=0xFF;
+      Sim_Memory[SIM_TRISA_ADDRESS+2]=0xFF;
+      Sim_Memory[SIM_TRISA_ADDRESS+3]=0xFF;
+      Sim_Memory[SIM_TRISA_ADDRESS+4]=0x07;
+      Sim_Memory[SIM_T0CON_ADDRESS]  =0xFF;
+      Sim_Memory[SIM_OSCCON_ADDRESS] =0x40;  /* IDLEN clear: SLEEP is full sleep */
+      Sim_Memory[SIM_INTCON2_ADDRESS]=0xF5;
+      Sim_Memory[SIM_INTCON3_ADDRESS]=0xC0;
+      Sim_Memory[SIM_IPR1_ADDRESS]   =0xFF;
+      Sim_Memory[SIM_IPR2_ADDRESS]   =0xDF;
+
+      Sim_Tmr0=0;
+      Sim_Tmr0HighBuffer=0;
+      Sim_Tmr0Prescaler=0;
+      Sim_Tmr0Inhibit=0;
+      Sim_Timer1.count=0;
+      Sim_Timer1.highBuffer=0;
+      Sim_Timer1.prescaler=0;
+      Sim_Timer3.count=0;
+      Sim_Timer3.highBuffer=0;
+      Sim_Timer3.prescaler=0;
+      Sim_T1OscPhase=0;
+      Sim_Tmr2=0;
+      Sim_Tmr2Prescaler=0;
+      Sim_Tmr2Postscaler=0;
+      Sim_KeypadRows=0;
+      Sim_KeypadCols=0;
+      Sim_EventsNumber=0;
+      Sim_InIsr=FALSE;
+      Sim_InIsrLow=FALSE;
+      Sim_Asleep=FALSE;
+      memset(Sim_PendingBits,0,sizeof(Sim_PendingBits));
+      memset(Sim_LatencyMaxOf,0,sizeof(Sim_LatencyMaxOf));
+      Sim_Running=FALSE;
+
+      Sim_PortBLevel=Sim_PortPins(SIM_PORTB);
+      Sim_PortBRead=Sim_PortBLevel;
+}
+
+uint8 Sim_RegisterRead(uint16 address)
+{
+      uint8 _Value;
+
+      address &= (SIM_MEMORY_SIZE-1);
+      Sim_ReadCount[address]++;
+      _Value=Sim_Peek(address);
+      Sim_Execute(SIM_CYCLES_PER_ACCESS);
+      return _Value;
+}
+
+void Sim_RegisterWrite(uint16 address, uint8 value)
+{
+      address &= (SIM_MEMORY_SIZE-1);
+      Sim_WriteCount[address]++;
+      Sim_Poke(address,value);
+      Sim_Execute(SIM_CYCLES_PER_ACCESS);
+}
+
+/* BSF/BCF/BTG are read-modify-write: PORTx is read from the pins */
+/* Bit and mask operations are one read-modify-write instruction */
+void Sim_RegisterSetBit(uint16 address, uint8 bitNo)
+{
+      Sim_RegisterSetMask(address,(uint8)(1<<bitNo));
+}
+
+void Sim_RegisterClearBit(uint16 address, uint8 bitNo)
+{
+      Sim_RegisterClearMask(address,(uint8)(1<<bitNo));
+}
+
+void Sim_RegisterToggleBit(uint16 address, uint8 bitNo)
+{
+      Sim_RegisterToggleMask(address,(uint8)(1<<bitNo));
+}
+
+void Sim_RegisterSetMask(uint16 address, uint8 mask)
+{
+      address &= (SIM_MEMORY_SIZE-1);
+      Sim_ReadCount[address]++;
+      Sim_WriteCount[address]++;
+      Sim_Poke(address,(uint8)(Sim_Peek(address) | mask));
+      Sim_Execute(SIM_CYCLES_PER_ACCESS);
+}
+
+void Sim_RegisterClearMask(uint16 address, uint8 mask)
+{
+      address &= (SIM_MEMORY_SIZE-1);
+      Sim_ReadCount[address]++;
+      Sim_WriteCount[address]++;
+      Sim_Poke(address,(uint8)(Sim_Peek(address) & ~mask));
+      Sim_Execute(SIM_CYCLES_PER_ACCESS);
+}
+
+void Sim_RegisterToggleMask(uint16 address, uint8 mask)
+{
+      address &= (SIM_MEMORY_SIZE-1);
+      Sim_ReadCount[address]++;
+      Sim_WriteCount[address]++;
+      Sim_Poke(address,(uint8)(Sim_Peek(address) ^ mask));
+      Sim_Execute(SIM_CYCLES_PER_ACCESS);
+}
+
+void Sim_SetLatchHook(void (*hook)(uint8 port, uint8 latch))
+{
+      Sim_LatchHook=hook;
+}
+
+void Sim_SetSleepHook(void (*hook)(void))
+{
+      Sim_SleepHook=hook;
+}
+
+void Sim_ResetCounters(void)
+{
+      memset(Sim_ReadCount,0,sizeof(Sim_ReadCount));
+      memset(Sim_WriteCount,0,sizeof(Sim_WriteCount));
+}
+
+uint32 Sim_GetReadCount(uint16 address)
+{
+      return Sim_ReadCount[address & (SIM_MEMORY_SIZE-1)];
+}
+
+uint32 Sim_GetWriteCount(uint16 address)
+{
+      return Sim_WriteCount[address & (SIM_MEMORY_SIZE-1)];
+}
+
+uint32 Sim_GetTotalReads(void)
+{
+      uint32 _Total=0;
+      uint16 _Address;
+
+      for(_Address=0; _Address<SIM_MEMORY_SIZE; _Address++) _Total+=Sim_ReadCount[_Address];
+      return _Total;
+}
+
+uint32 Sim_GetTotalWrites(void)
+{
+      uint32 _Total=0;
+      uint16 _Address;
+
+      for(_Address=0; _Address<SIM_MEMORY_SIZE; _Address++) _Total+=Sim_WriteCount[_Address];
+      return _Total;
+}
+
+const char * Sim_RegisterName(uint16 address)
+{
+      uint8 _Index;
+
+      for(_Index=0; _Index<sizeof(Sim_Names)/sizeof(Sim_Names[0]); _Index++)
+      {
+            if(Sim_Names[_Index].address==address) return Sim_Names[_Index].name;
+      }
+      return (const char *)NULL_PTR;
+}
+
+void Sim_ReportCounters(const char * title)
+{
+      uint16 _Address;
+      const char * _Name;
+
+      printf("%s\n",title);
+      printf("  %-8s %8s %8s\n","register","reads","writes");
+      for(_Address=0; _Address<SIM_MEMORY_SIZE; _Address++)
+      {
+            if(Sim_ReadCount[_Address]==0 && Sim_WriteCount[_Address]==0) continue;
+            _Name=Sim_RegisterName(_Address);
+            if(_Name) printf("  %-8s %8u %8u\n",_Name,Sim_ReadCount[_Address],Sim_WriteCount[_Address]);
+            else      printf("  0x%04X   %8u %8u\n",_Address,Sim_ReadCount[_Address],Sim_WriteCount[_Address]);
+      }
+      printf("  %-8s %8u %8u\n","total",Sim_GetTotalReads(),Sim_GetTotalWrites());
+}
+
+void Sim_Advance(uint64 cycles)
+{
+      uint64 _Left=cycles;
+      uint64 _Step;
+      uint64 _Next;
+      uint64 _Overflow;
+
+      while(_Left>0)
+      {
+            _Step=_Left;
+            /* Stop at the next timer flag, input event and end of run */
+            _Next=Sim_CyclesToTimerFlag();
+            if(_Next>0 && _Next<_Step) _Step=_Next;
+            if(Sim_EventsNumber>0)
+            {
+                  _Next=(Sim_Events[0].cycle > Sim_Stats.cycles) ? Sim_Events[0].cycle-Sim_Stats.cycles : 0;
+                  if(_Next<_Step) _Step=_Next;
+            }
+            if(Sim_Running)
+            {
+                  _Next=(Sim_EndCycle > Sim_Stats.cycles) ? Sim_EndCycle-Sim_Stats.cycles : 0;
+                  if(_Next<_Step) _Step=_Next;
+            }
+
+            if(Sim_Asleep)
+            {
+                  Sim_Stats.sleepCycles+=_Step;
+                  /* IDLEN clear, the oscillator is off */
+                  if(Sim_MainClockStopped()) Sim_Stats.deepSleepCycles+=_Step;
+            }
+            Sim_Timer0Advance(_Step);
+            _Overflow=Sim_Timer13CyclesToOverflow(&Sim_Timer1);
+            if(Sim_Timer13Advance(&Sim_Timer1,_Step))
+            {
+                  Sim_Stats.timer1Overflows++;
+                  Sim_Stats.timer1OverflowCycle=Sim_Stats.cycles+_Overflow;
+            }
+            Sim_Timer13Advance(&Sim_Timer3,_Step);
+            Sim_T1OscPhase=(uint32)((Sim_T1OscPhase+_Step*SIM_T1OSC_HZ)%(SIM_FOSC_HZ/4));
+            Sim_Timer2Advance(_Step);
+            Sim_Stats.cycles+=_Step;
+            _Left-=_Step;
+            Sim_ApplyDueEvents();
+            Sim_TrackPending();
+
+            if(Sim_Running && Sim_Stats.cycles >= Sim_EndCycle)
+            {
+                  longjmp(Sim_ExitPoint,1);
+            }
+      }
+}
+
+uint32 Sim_LatencyMax(uint16 flagAddress, uint8 bitNo)
+{
+      static const uint16 _Rows[SIM_INT_ROWS]=
+             {SIM_INTCON_ADDRESS,SIM_INTCON3_ADDRESS,SIM_PIR1_ADDRESS,SIM_PIR2_ADDRESS};
+      uint8 _Row;
+
+      for(_Row=0; _Row<SIM_INT_ROWS; _Row++)
+      {
+            if(_Rows[_Row]==flagAddress && bitNo<8) return Sim_LatencyMaxOf[_Row][bitNo];
+      }
+      return 0;
+}
+
+void Sim_Execute(uint32 cycles)
+{
+      Sim_Advance(cycles);
+      Sim_ServiceInterrupts();
+}
+
+void Sim_Sleep(void)
+{
+      uint64 _Step;
+      uint64 _Next;
+
+      if(Sim_SleepHook) Sim_SleepHook();
+      Sim_Asleep=TRUE;  /* Sim_Advance counts the sleep cycles */
+      while(!Sim_InterruptRequested())
+      {
+            /* Sleep until the next thing that can happen */
+            _Step=Sim_CyclesToTimerFlag();
+            if(Sim_EventsNumber>0)
+            {
+                  _Next=(Sim_Events[0].cycle > Sim_Stats.cycles) ? Sim_Events[0].cycle-Sim_Stats.cycles : 1;
+                  if(_Step==0 || _Next<_Step) _Step=_Next;
+            }
+            if(_Step==0) /* Nothing can wake the core anymore */
+            {
+                  if(Sim_Running) Sim_Advance(Sim_EndCycle-Sim_Stats.cycles); /* Ends the run */
+                  Sim_Asleep=FALSE;
+                  return;
+            }
+            Sim_Advance(_Step);
+      }
+      Sim_Asleep=FALSE;
+      Sim_Stats.wakeups++;
+      Sim_ServiceInterrupts();
+}
+
+uint64 Sim_Now(void)
+{
+      return Sim_Stats.cycles;
+}
+
+uint32 Sim_NowMs(void)
+{
+      return (uint32)(Sim_Stats.cycles/SIM_CYCLES_PER_MS);
+}
+
+void Sim_SetInput(uint8 port, uint8 pin, uint8 level)
+{
+      if(level) Sim_InputLevel[port] |=  (1<<pin);
+      else      Sim_InputLevel[port] &=~ (1<<pin);
+      Sim_UpdatePins();
+}
+
+void Sim_ScheduleInput(uint32 atMs, uint8 port, uint8 pin, uint8 level)
+{
+      Sim_ScheduleEvent((uint64)atMs*SIM_CYCLES_PER_MS,SIM_EVENT_INPUT,port,pin,level);
+}
+
+void Sim_ScheduleInputCycle(uint64 cycle, uint8 port, uint8 pin, uint8 level)
+{
+      Sim_ScheduleEvent(cycle,SIM_EVENT_INPUT,port,pin,level);
+}
+
+uint64 Sim_Timer0NextOverflow(void)
+{
+      if(!Sim_Timer0Running()) return 0;
+      return Sim_Stats.cycles+Sim_Timer0CyclesToOverflow();
+}
+
+void Sim_KeypadConnect(uint8 rowsNumber, const uint8 * rowsPort, const uint8 * rowsPin,
+                       uint8 colsNumber, const uint8 * colsPort, const uint8 * colsPin)
+{
+      uint8 _Index;
+
+      Sim_KeypadRows=rowsNumber;
+      Sim_KeypadCols=colsNumber;
+      for(_Index=0; _Index<rowsNumber; _Index++)
+      {
+            Sim_KeypadRowPort[_Index]=rowsPort[_Index];
+            Sim_KeypadRowPin[_Index]=rowsPin[_Index];
+      }
+      for(_Index=0; _Index<colsNumber; _Index++)
+      {
+            Sim_KeypadColPort[_Index]=colsPort[_Index];
+            Sim_KeypadColPin[_Index]=colsPin[_Index];
+      }
+      Sim_UpdatePins();
+}
+
+void Sim_SetKey(uint8 row, uint8 col, uint8 down)
+{
+      Sim_KeyDown[row][col]=down;
+      Sim_UpdatePins();
+}
+
+void Sim_ScheduleKey(uint32 atMs, uint8 row, uint8 col, uint8 down)
+{
+      Sim_ScheduleEvent((uint64)atMs*SIM_CYCLES_PER_MS,SIM_EVENT_KEY,row,col,down);
+}
+
+void Sim_ScheduleProbe(uint32 atMs, void (*probe)(void))
+{
+      Sim_ScheduleEvent((uint64)atMs*SIM_CYCLES_PER_MS,SIM_EVENT_PROBE,0,0,0)->probe=probe;
+}
+
+void Sim_RunFirmware(void (*entry)(void), uint32 durationMs)
+{
+      Sim_EndCycle=Sim_Stats.cycles+(uint64)durationMs*SIM_CYCLES_PER_MS;
+      if(setjmp(Sim_ExitPoint)==0)
+      {
+            Sim_Running=TRUE;
+            entry();
+      }
+      Sim_Running=FALSE;
+      Sim_Asleep=FALSE;   /* The run may end asleep */
+      if(Sim_InIsr || Sim_InIsrLow) /* The run may end inside the ISRs */
+      {
+            Sim_Memory[SIM_INTCON_ADDRESS] |= (1<<SIM_GIE);
+            if(Sim_InIsrLow) Sim_Memory[SIM_INTCON_ADDRESS] |= (1<<SIM_PEIE);
+            Sim_InIsr=FALSE;
+            Sim_InIsrLow=FALSE;
+      }
+}
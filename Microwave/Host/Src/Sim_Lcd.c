@@ -0,0 +1,319 @@
+/*****************************************************************************/
+/** File:    Sim_Lcd.c                                                      **/
+/**                                                                         **/
+/** Description: This file is the simulated HD44780 LCD, it decodes the     **/
+/**              transfers written on its pins, keeps the display RAM to    **/
+/**              render the screen and is busy for the execution time of   **/
+/**              every instruction (busy flag read over R/W). Every pin     **/
+/**              change is checked against the bus timing of the LCD.      **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+/* Inclusion */
+#include <stdio.h>
+#include <string.h>
+#include "Sim_Core.h"
+#include "Sim_Lcd.h"
+
+/* Local Macros */
+#define SIM_LCD_DDRAM_SIZE   0x80
+#define SIM_LCD_NS_PER_CYCLE (1000/SIM_CYCLES_PER_US)
+#define SIM_LCD_REPORTED     5     /* Violations printed per frame */
+
+/* Global variables */
+Sim_LcdStatsType Sim_LcdStats;
+
+/* Private variables */
+static char   Sim_LcdDdram[SIM_LCD_DDRAM_SIZE];
+static uint8  Sim_LcdAddress;
+static uint64 Sim_LcdBusyUntil;   /* Cycle the running instruction ends */
+static uint32 Sim_LcdByteNs=SIM_LCD_BYTE_NS;    /* Execution times */
+static uint32 Sim_LcdClearNs=SIM_LCD_CLEAR_NS;
+
+/* Pins of the 4 bits bus */
+static uint8 Sim_LcdControlPort;
+static uint8 Sim_LcdRsPin;
+static uint8 Sim_LcdRwPin;
+static uint8 Sim_LcdEnPin;
+static uint8 Sim_LcdDataPort;
+static uint8 Sim_LcdD4Pin;
+static uint8 Sim_LcdEnLevel;      /* EN at the last latch write */
+static uint8 Sim_LcdFourBits;     /* 4 bits bus set by a function set */
+static uint8 Sim_LcdLowNibble;    /* Next nibble is the low one */
+static uint8 Sim_LcdHighNibble;
+static uint8 Sim_LcdReadLow;      /* Next read nibble is the low one */
+static uint8 Sim_LcdAddressPins;  /* RS and R/W at the last latch write */
+static uint8 Sim_LcdDataPins;     /* D4..D7 at the last latch write */
+
+/* Cycle of the last change of every bus signal */
+static uint64 Sim_LcdAddressChange;
+static uint64 Sim_LcdDataChange;
+static uint64 Sim_LcdEnRise;
+static uint64 Sim_LcdEnFall;
+static uint64 Sim_LcdByteStart;   /* First EN rise of the byte */
+static uint64 Sim_LcdBusEnd;      /* End of the last counted bus time */
+static uint64 Sim_LcdPollStart;   /* R/W rise */
+static uint8  Sim_LcdFirstNibble; /* Next EN rise starts a byte */
+
+/* Start address of the 4 rows of the 4x16 glass */
+static const uint8 Sim_LcdRowStart[SIM_LCD_ROWS]={0x00,0x40,0x10,0x50};
+
+/* Private functions prototype */
+static void Sim_LcdApply(uint8 isData, uint8 value);
+static void Sim_LcdRead(void);
+static void Sim_LcdViolation(uint32 * counter, const char * what, uint64 ns);
+static void Sim_LcdCheckTiming(uint8 address, uint8 data, uint8 en);
+static void Sim_LcdLatchWritten(uint8 port, uint8 latch);
+
+/* Private functions defination */
+/* One byte received by the controller: display RAM, counters and busy */
+static void Sim_LcdApply(uint8 isData, uint8 value)
+{
+      uint32 _Ns=Sim_LcdByteNs;
+
+      if(Sim_Now() < Sim_LcdBusyUntil)  /* Written before the end of the last one */
+      {
+            Sim_LcdViolation(&Sim_LcdStats.busyWrites,"written while busy, execution left",
+                             (Sim_LcdBusyUntil-Sim_Now())*SIM_LCD_NS_PER_CYCLE);
+      }
+      if(isData)
+      {
+            Sim_LcdStats.characters++;
+            Sim_LcdDdram[Sim_LcdAddress]=(char)value;
+            Sim_LcdAddress=(Sim_LcdAddress+1) & (SIM_LCD_DDRAM_SIZE-1);
+      }
+      else
+      {
+            Sim_LcdStats.commands++;
+            if(value & 0x80)                 /* Set DDRAM address */
+            {
+                  Sim_LcdAddress=value & 0x7F;
+            }
+            else if((value & 0xE0)==0x20)    /* Function set, DL bit */
+            {
+                  Sim_LcdFourBits=!(value & 0x10);
+            }
+            else if(value==0x01)             /* Clear display */
+            {
+                  memset(Sim_LcdDdram,' ',sizeof(Sim_LcdDdram));
+                  Sim_LcdAddress=0;
+                  _Ns=Sim_LcdClearNs;
+            }
+            else if(value==0x02 || value==0x03) /* Return home */
+            {
+                  Sim_LcdAddress=0;
+                  _Ns=Sim_LcdClearNs;
+            }
+      }
+      Sim_LcdBusyUntil=Sim_Now()+(uint64)_Ns*SIM_CYCLES_PER_US/1000;
+      /* Bus time of the byte, overlaps with the last one counted once */
+      if(Sim_LcdByteStart < Sim_LcdBusEnd)   Sim_LcdByteStart=Sim_LcdBusEnd;
+      Sim_LcdStats.busCycles+=Sim_LcdBusyUntil-Sim_LcdByteStart;
+      Sim_LcdBusEnd=Sim_LcdBusyUntil;
+}
+
+static void Sim_LcdViolation(uint32 * counter, const char * what, uint64 ns)
+{
+      if(Sim_LcdViolations() < SIM_LCD_REPORTED)
+      {
+            printf("  LCD timing: %s %llu ns at %.1f us\n",what,(unsigned long long)ns,
+                   (double)Sim_Now()/SIM_CYCLES_PER_US);
+      }
+      (*counter)++;
+}
+
+/* Setup, hold and EN times of a change of the bus signals, every time is */
+/* a number of cycles (0 ns if two signals change in the same write)       */
+static void Sim_LcdCheckTiming(uint8 address, uint8 data, uint8 en)
+{
+      uint64 _Now=Sim_Now();
+
+      if(address != Sim_LcdAddressPins)
+      {
+            if(Sim_LcdEnLevel)
+                  Sim_LcdViolation(&Sim_LcdStats.holdErrors,"RS/RW changed with EN HIGH, tAH",0);
+            else if((_Now-Sim_LcdEnFall)*SIM_LCD_NS_PER_CYCLE < SIM_LCD_TAH_NS)
+                  Sim_LcdViolation(&Sim_LcdStats.holdErrors,"RS/RW hold tAH",(_Now-Sim_LcdEnFall)*SIM_LCD_NS_PER_CYCLE);
+            Sim_LcdAddressChange=_Now;
+      }
+      if(data != Sim_LcdDataPins)
+      {
+            if(!Sim_LcdEnLevel && (_Now-Sim_LcdEnFall)*SIM_LCD_NS_PER_CYCLE < SIM_LCD_TH_NS && !en)
+                  Sim_LcdViolation(&Sim_LcdStats.holdErrors,"data hold tH",(_Now-Sim_LcdEnFall)*SIM_LCD_NS_PER_CYCLE);
+            Sim_LcdDataChange=_Now;
+      }
+      if(!Sim_LcdEnLevel && en)
+      {
+            if((_Now-Sim_LcdAddressChange)*SIM_LCD_NS_PER_CYCLE < SIM_LCD_TAS_NS)
+                  Sim_LcdViolation(&Sim_LcdStats.setupErrors,"RS/RW setup tAS",(_Now-Sim_LcdAddressChange)*SIM_LCD_NS_PER_CYCLE);
+            if(Sim_LcdStats.enablePulses && (_Now-Sim_LcdEnRise)*SIM_LCD_NS_PER_CYCLE < SIM_LCD_TCYCE_NS)
+                  Sim_LcdViolation(&Sim_LcdStats.pulseErrors,"EN cycle tcycE",(_Now-Sim_LcdEnRise)*SIM_LCD_NS_PER_CYCLE);
+            Sim_LcdEnRise=_Now;
+            if(Sim_LcdFirstNibble)  Sim_LcdByteStart=_Now;
+      }
+      else if(Sim_LcdEnLevel && !en)
+      {
+            if((_Now-Sim_LcdEnRise)*SIM_LCD_NS_PER_CYCLE < SIM_LCD_PWEH_NS)
+                  Sim_LcdViolation(&Sim_LcdStats.pulseErrors,"EN width PWEH",(_Now-Sim_LcdEnRise)*SIM_LCD_NS_PER_CYCLE);
+            if(!(address & 2) && (_Now-Sim_LcdDataChange)*SIM_LCD_NS_PER_CYCLE < SIM_LCD_TDSW_NS)
+                  Sim_LcdViolation(&Sim_LcdStats.setupErrors,"data setup tDSW",(_Now-Sim_LcdDataChange)*SIM_LCD_NS_PER_CYCLE);
+            Sim_LcdEnFall=_Now;
+            Sim_LcdStats.enablePulses++;
+      }
+      Sim_LcdAddressPins=address;
+      Sim_LcdDataPins=data;
+}
+
+/* EN rise with R/W HIGH: the LCD drives D4..D7, busy flag and address */
+/* counter high bits first, then the low bits                           */
+static void Sim_LcdRead(void)
+{
+      uint8 _Nibble;
+      uint8 _Pin;
+
+      if(Sim_LcdReadLow)
+      {
+            _Nibble=Sim_LcdAddress & 0x0F;
+      }
+      else
+      {
+            _Nibble=(Sim_LcdAddress>>4) & 0x07;
+            if(Sim_Now() < Sim_LcdBusyUntil)  _Nibble |= 0x08;
+            Sim_LcdStats.busyReads++;
+      }
+      for(_Pin=0; _Pin<4; _Pin++)
+      {
+            Sim_SetInput(Sim_LcdDataPort,Sim_LcdD4Pin+_Pin,(_Nibble>>_Pin) & 1);
+      }
+}
+
+/* The controller takes D4..D7 on the falling edge of EN. On the 8 bits bus */
+/* (after power on) D0..D3 are not wired and read LOW, on the 4 bits bus   */
+/* two nibbles make a byte, the high one first.                            */
+static void Sim_LcdLatchWritten(uint8 port, uint8 latch)
+{
+      uint8 _Control;
+      uint8 _En;
+      uint8 _Rs;
+      uint8 _Read;
+      uint8 _Nibble;
+
+      if(port!=Sim_LcdControlPort && port!=Sim_LcdDataPort) return;
+      _Control=Sim_Memory[SIM_LATA_ADDRESS+Sim_LcdControlPort];
+      _En=(_Control >> Sim_LcdEnPin) & 1;
+      _Rs=(_Control >> Sim_LcdRsPin) & 1;
+      _Read=(Sim_LcdRwPin!=SIM_LCD_NOT_WIRED) && ((_Control >> Sim_LcdRwPin) & 1);
+      _Nibble=(Sim_Memory[SIM_LATA_ADDRESS+Sim_LcdDataPort] >> Sim_LcdD4Pin) & 0x0F;
+      if(_Read && !(Sim_LcdAddressPins & 2))        Sim_LcdPollStart=Sim_Now();
+      else if(!_Read && (Sim_LcdAddressPins & 2))   Sim_LcdStats.pollCycles+=Sim_Now()-Sim_LcdPollStart;
+      Sim_LcdCheckTiming((uint8)(_Rs | (_Read<<1)),_Nibble,_En);
+      if(_Read)
+      {
+            if(!Sim_LcdEnLevel && _En)        Sim_LcdRead();
+            else if(Sim_LcdEnLevel && !_En)   Sim_LcdReadLow=Sim_LcdFourBits && !Sim_LcdReadLow;
+      }
+      else if(Sim_LcdEnLevel && !_En)
+      {
+            if(!Sim_LcdFourBits)
+            {
+                  Sim_LcdApply(_Rs,(uint8)(_Nibble<<4));
+            }
+            else if(Sim_LcdLowNibble)
+            {
+                  Sim_LcdApply(_Rs,(uint8)((Sim_LcdHighNibble<<4) | _Nibble));
+                  Sim_LcdLowNibble=FALSE;
+            }
+            else
+            {
+                  Sim_LcdHighNibble=_Nibble;
+                  Sim_LcdLowNibble=TRUE;
+            }
+      }
+      Sim_LcdFirstNibble=!Sim_LcdLowNibble || _Read;
+      Sim_LcdEnLevel=_En;
+      (void)latch;
+}
+
+/* Public functions defination */
+void Sim_LcdConnect(uint8 controlPort, uint8 rsPin, uint8 rwPin, uint8 enPin,
+                    uint8 dataPort, uint8 d4Pin)
+{
+      Sim_LcdControlPort=controlPort;
+      Sim_LcdRsPin=rsPin;
+      Sim_LcdRwPin=rwPin;
+      Sim_LcdEnPin=enPin;
+      Sim_LcdDataPort=dataPort;
+      Sim_LcdD4Pin=d4Pin;
+      Sim_LcdEnLevel=(Sim_Memory[SIM_LATA_ADDRESS+controlPort] >> enPin) & 1;
+      /* Power on: garbage on the glass is blank, 8 bits bus */
+      memset(Sim_LcdDdram,' ',sizeof(Sim_LcdDdram));
+      Sim_LcdAddress=0;
+      Sim_LcdBusyUntil=0;
+      Sim_LcdFourBits=FALSE;
+      Sim_LcdLowNibble=FALSE;
+      Sim_LcdReadLow=FALSE;
+      Sim_LcdFirstNibble=TRUE;
+      Sim_LcdAddressPins=0;
+      Sim_LcdDataPins=0;
+      Sim_LcdAddressChange=0;
+      Sim_LcdDataChange=0;
+      Sim_LcdEnRise=0;
+      Sim_LcdEnFall=0;
+      Sim_LcdBusEnd=0;
+      Sim_LcdPollStart=0;
+      Sim_SetLatchHook(Sim_LcdLatchWritten);
+}
+
+void Sim_LcdSetExecution(uint32 byteNs, uint32 clearNs)
+{
+      Sim_LcdByteNs=byteNs;
+      Sim_LcdClearNs=clearNs;
+}
+
+void Sim_LcdResetStats(void)
+{
+      memset(&Sim_LcdStats,0,sizeof(Sim_LcdStats));
+}
+
+uint32 Sim_LcdViolations(void)
+{
+      return Sim_LcdStats.busyWrites+Sim_LcdStats.setupErrors+
+             Sim_LcdStats.holdErrors+Sim_LcdStats.pulseErrors;
+}
+
+void Sim_LcdReport(const char * title)
+{
+      printf("  %s\n",title);
+      printf("    bytes %u (commands %u, characters %u), EN pulses %u, busy reads %u\n",
+             Sim_LcdStats.commands+Sim_LcdStats.characters,Sim_LcdStats.commands,
+             Sim_LcdStats.characters,Sim_LcdStats.enablePulses,Sim_LcdStats.busyReads);
+      printf("    bus time %.3f ms, busy flag polling %.1f us\n",
+             (double)Sim_LcdStats.busCycles/SIM_CYCLES_PER_MS,
+             (double)Sim_LcdStats.pollCycles/SIM_CYCLES_PER_US);
+      printf("    violations: setup %u, hold %u, EN %u, execution %u\n",
+             Sim_LcdStats.setupErrors,Sim_LcdStats.holdErrors,
+             Sim_LcdStats.pulseErrors,Sim_LcdStats.busyWrites);
+}
+
+void Sim_LcdGetRow(uint8 row, char * buffer)
+{
+      memcpy(buffer,&Sim_LcdDdram[Sim_LcdRowStart[row]],SIM_LCD_COLUMNS);
+      buffer[SIM_LCD_COLUMNS]='\0';
+}
+
+void Sim_LcdRender(void)
+{
+      char  _Line[SIM_LCD_COLUMNS+1];
+      uint8 _Row;
+
+      printf("  +----------------+\n");
+      for(_Row=0; _Row<SIM_LCD_ROWS; _Row++)
+      {
+            Sim_LcdGetRow(_Row,_Line);
+            printf("  |%s|\n",_Line);
+      }
+      printf("  +----------------+\n");
+}
@@ -0,0 +1,790 @@
+/*****************************************************************************/
+/** File:    Sim_Main.c                                                     **/
+/**                                                                         **/
+/** Description: This file is the entry point of the host build, it runs   **/
+/**              the firmware scenarios on the simulator and prints the     **/
+/**              register access counters.                                  **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#undef main   /* Sim_mikroC.h renames the firmware main */
+
+/* Inclusion */
+#include <stdio.h>
+#include <string.h>
+#include "Sim_Core.h"
+#include "Sim_Lcd.h"
+#include "Sim_Bench.h"
+#include "HAL.h"
+#include "Module_Keypad.h"
+#include "Module_LcdBuffer.h"
+#include "Module_LcdQueue.h"
+#include "Module_SoftTimer.h"
+#include "Module_Profile.h"
+#include "APP_Functions.h"
+#include "Pins_Config.h"
+
+/* Local macros */
+/* Port index and pin number of a "PORTx_BASE_ADDRESS,PIN_n" definition */
+#define SIM_PORT_OF(PIN_DEF)     SIM_PORT_OF_(PIN_DEF)
+#define SIM_PIN_OF(PIN_DEF)      SIM_PIN_OF_(PIN_DEF)
+#define SIM_PORT_OF_(PORT,PIN)   ((uint8)((PORT)-SIM_PORTA_ADDRESS))
+#define SIM_PIN_OF_(PORT,PIN)    (PIN)
+
+#define SIM_PRESS_MS  150  /* Key and button hold time, longer than debounce */
+#define SIM_MINUTE_MS 60000UL
+#define SIM_WAKE_SEGMENTS 5
+/* Estimated supply current at 8 MHz, 5 V: running, PRI_IDLE (the core    */
+/* sleeps, a timer counts Tcy) and sleep with the oscillator off, Timer1   */
+/* oscillator on. Take the values of the datasheet for the part.           */
+#define SIM_RUN_UA    2200
+#define SIM_IDLE_UA   550
+#define SIM_SLEEP_UA  2
+#define SIM_BURST_MS  80   /* Fast tap: press and gap times */
+#define SIM_BURST_TAPS 29  /* '#' taps, Edit_Position ends at 29%6 = 5 */
+#define SIM_TICK_MS   APP_RTC_TICK_MS  /* Timer1 tick of the soft timers */
+#define SIM_TICK_CYCLES ((uint64)SIM_TICK_MS*SIM_CYCLES_PER_MS)
+#define SIM_COUNTDOWN_HOURS 99
+#define SIM_HOUR_MS   3600000UL
+/* Time_DataType fields are packed BCD */
+#define SIM_BCD(VALUE)       ((uint8)((((VALUE)/10)<<4) | ((VALUE)%10)))
+#define SIM_BCD_VALUE(BCD)   ((uint32)((BCD)>>4)*10+((BCD)&0x0F))
+
+/* Local data types */
+typedef struct{
+        const char * name;
+        const char * description;
+        void (*run)(void);
+}Sim_ScenarioType;
+
+/* Externed firmware variables */
+extern APP_stateType ProgramState;
+extern Time_DataType App_Time;
+extern Keypad_ConfigType Keypad1;
+extern uint8 Edit_Position;
+extern SoftTimer_Type App_SecondTimer;
+
+/* Local variables */
+static const char * const Sim_WakeSegments[SIM_WAKE_SEGMENTS]={
+        "Edit, idle","Edit, a key every 1 s","Run","Notification","OFF"
+};
+static uint32 Sim_WakeCount[2*SIM_WAKE_SEGMENTS];  /* Begin and end of each */
+static uint64 Sim_WakeCycles[2*SIM_WAKE_SEGMENTS]; /* Time and time asleep */
+static uint64 Sim_WakeSleepCycles[2*SIM_WAKE_SEGMENTS];
+static uint64 Sim_WakeDeepCycles[2*SIM_WAKE_SEGMENTS];
+static uint32 Sim_WakeTimer0[2*SIM_WAKE_SEGMENTS]; /* Deadlines: overflows */
+static uint32 Sim_WakeTimer1[2*SIM_WAKE_SEGMENTS];
+static uint8  Sim_WakeMarks;
+static uint64 Sim_PassCycle;      /* Start of the measured pass */
+static uint64 Sim_PassIsrCycles;  /* Interrupt cycles at its start */
+static int    Sim_ExitStatus=0;   /* 1 when a scenario check failed */
+static uint32 Sim_DriftOverflows; /* Timer1 overflows at the countdown start */
+static uint64 Sim_DriftCycle;     /* and the cycle of the last one */
+static uint32 Sim_DriftTicks;     /* Ticks left to the end of the countdown */
+static uint32 Sim_DriftOverflows0; /* Timer0 overflows at the held key */
+static uint64 Sim_DriftCycle0;     /* and the cycle of the last one */
+static uint32 Sim_GlitchLead;     /* Cycles from the RB glitch to the tick */
+static uint8  Sim_DriftChecked;
+static uint32 Sim_LcdSleeps;      /* Sleeps with LCD bytes queued */
+static uint32 Sim_LcdStuckSleeps; /* and of these, the full sleeps */
+
+/* Private functions prototype */
+static void Sim_BoardReset(void);
+static void Sim_ScheduleKeyPress(uint32 atMs, uint8 row, uint8 col);
+static void Sim_ReportLcd(const char * title);
+static void Sim_LcdDrain(void);
+static void Sim_PassStart(void);
+static void Sim_ReportPass(const char * title);
+static void Sim_ScenarioEditPass(void);
+static void Sim_ProbeScreen(void);
+static void Sim_ScenarioDemo(void);
+static void Sim_ProbeWakeMark(void);
+static void Sim_ProbeSetTime(void);
+static void Sim_ScenarioWakeRate(void);
+static void Sim_ScenarioKeypadScan(void);
+static void Sim_ScenarioGpioShadow(void);
+static void Sim_ScenarioKeypadBurst(void);
+static void Sim_ScenarioLcdThroughput(void);
+static void Sim_LcdFrameEnd(const char * title, const char * const * screen);
+static void Sim_ScenarioLcdFrame(void);
+static void Sim_LcdSleepChecked(void);
+static void Sim_ProbeLcdBlank(void);
+static void Sim_ScenarioLcdSleep(void);
+static void Sim_ProbeSetCountdown(void);
+static void Sim_ProbeDriftStart(void);
+static void Sim_ProbeDriftTimer0Start(void);
+static void Sim_ProbeDriftTimer0(void);
+static void Sim_ProbeDriftEnd(void);
+static void Sim_ScenarioTimebaseDrift(void);
+static void Sim_ProbeGlitchAtTick(void);
+static void Sim_ScenarioIrqLatency(void);
+#if PROFILE_ENABLE
+static void Sim_ProfilePut(char Character);
+#endif
+static void Sim_ScenarioProfile(void);
+
+/* Scenarios table */
+static const Sim_ScenarioType Sim_Scenarios[]={
+        {"edit-pass","SFR accesses of one APP_Edit_Mode() pass",Sim_ScenarioEditPass},
+        {"demo",     "Full firmware: wake, set 5 s, cook, notify",Sim_ScenarioDemo},
+        {"bench-gpio","GPIO device, handle, pin and port-group API calls",Sim_BenchGpio},
+        {"bench-time","Countdown second-tick, binary with divisions against BCD",Sim_BenchTime},
+        {"keypad-scan","SFR accesses of one Keypad_update() scan",Sim_ScenarioKeypadScan},
+        {"gpio-shadow","Latch bits set before GPIO_DeviceInit kept by the shadowed writes",Sim_ScenarioGpioShadow},
+        {"keypad-burst","Fast '#' taps in Edit, keys counted and lost",Sim_ScenarioKeypadBurst},
+        {"wake-rate","Wakeups and estimated current of each state (make compare-wake)",Sim_ScenarioWakeRate},
+        {"lcd-throughput","LCD init and layout time per LCD clock (make compare-lcd)",Sim_ScenarioLcdThroughput},
+        {"lcd-frame","LCD bus transactions and timing of each screen update",Sim_ScenarioLcdFrame},
+        {"lcd-sleep","LCD bytes queued across a sleep, idle until they are sent",Sim_ScenarioLcdSleep},
+        {"timebase-drift","Timer0 and Timer1 ticks against simulated time over a 99 h countdown",Sim_ScenarioTimebaseDrift},
+        {"irq-latency","Worst interrupt latency per source and priority (make compare-latency)",Sim_ScenarioIrqLatency},
+        {"profile","Profiling probes dump after the demo inputs (make profile)",Sim_ScenarioProfile}
+};
+
+/* Private functions defination */
+/* Reset the simulator, wire the keypad of Keypad_Config.h and the LCD */
+static void Sim_BoardReset(void)
+{
+      uint8 _RowsPort[KEYPAD_MAX_ROW_NUMBER];
+      uint8 _RowsPin[KEYPAD_MAX_ROW_NUMBER];
+      uint8 _ColsPort[KEYPAD_MAX_COL_NUMBER];
+      uint8 _ColsPin[KEYPAD_MAX_COL_NUMBER];
+      uint8 _Index;
+
+      Sim_Reset();
+      Sim_LcdResetStats();
+      for(_Index=0; _Index<Keypad1.rowsNumber; _Index++)
+      {
+            _RowsPort[_Index]=(uint8)(Keypad1.rowConfiguration[_Index].devicePortBaseAddress-SIM_PORTA_ADDRESS);
+            _RowsPin[_Index] =Keypad1.rowConfiguration[_Index].devicePin;
+      }
+      for(_Index=0; _Index<Keypad1.colsNumber; _Index++)
+      {
+            _ColsPort[_Index]=(uint8)(Keypad1.colConfiguration[_Index].devicePortBaseAddress-SIM_PORTA_ADDRESS);
+            _ColsPin[_Index] =Keypad1.colConfiguration[_Index].devicePin;
+      }
+      Sim_KeypadConnect(Keypad1.rowsNumber,_RowsPort,_RowsPin,
+                        Keypad1.colsNumber,_ColsPort,_ColsPin);
+      Sim_LcdConnect(SIM_PORT_OF(LCD_RS_PIN),SIM_PIN_OF(LCD_RS_PIN),
+                     LCD_RW_WIRED ? SIM_PIN_OF(LCD_RW_PIN) : SIM_LCD_NOT_WIRED,
+                     SIM_PIN_OF(LCD_EN_PIN),SIM_PORT_OF(LCD_D4_PIN),SIM_PIN_OF(LCD_D4_PIN));
+}
+
+static void Sim_ScheduleKeyPress(uint32 atMs, uint8 row, uint8 col)
+{
+      Sim_ScheduleKey(atMs,row,col,TRUE);
+      Sim_ScheduleKey(atMs+SIM_PRESS_MS,row,col,FALSE);
+}
+
+static void Sim_ReportLcd(const char * title)
+{
+      printf("  %s: %u commands, %u characters, %.3f ms bus time\n",title,
+             Sim_LcdStats.commands,Sim_LcdStats.characters,
+             (double)Sim_LcdStats.busCycles/SIM_CYCLES_PER_MS);
+}
+
+/* Let the LCD interrupt send all queued bytes */
+static void Sim_LcdDrain(void)
+{
+      while(LcdQueue_isEmpty()==FALSE) Sim_Execute(SIM_CYCLES_PER_US);
+}
+
+static void Sim_PassStart(void)
+{
+      Sim_PassCycle=Sim_Now();
+      Sim_PassIsrCycles=Sim_Stats.isrCycles;
+}
+
+/* Time of the pass in main context, interrupts are printed apart */
+static void Sim_ReportPass(const char * title)
+{
+      uint64 _Isr=Sim_Stats.isrCycles-Sim_PassIsrCycles;
+      uint64 _Main=Sim_Now()-Sim_PassCycle-_Isr;
+
+      printf("  %s: %.1f us main loop, %.1f us interrupts\n",title,
+             (double)_Main/SIM_CYCLES_PER_US,(double)_Isr/SIM_CYCLES_PER_US);
+}
+
+static void Sim_ScenarioEditPass(void)
+{
+      Sim_BoardReset();
+      APP_Init();
+      Sim_LcdDrain();
+      Sim_PassStart();
+      APP_WakeUp_Mode();
+      Sim_ReportPass("APP_WakeUp_Mode() (layout)");
+      Sim_LcdDrain();
+
+      Sim_ResetCounters();
+      Sim_LcdResetStats();
+      Sim_PassStart();
+      APP_Edit_Mode();
+      Sim_ReportPass("APP_Edit_Mode(), first    ");
+      Sim_ReportCounters("SFR accesses of one APP_Edit_Mode() pass:");
+      Sim_LcdDrain();
+      Sim_ReportLcd("LCD, first pass");
+      /* Nothing changed on the screen since the first pass */
+      Sim_LcdResetStats();
+      Sim_PassStart();
+      APP_Edit_Mode();
+      Sim_ReportPass("APP_Edit_Mode(), next     ");
+      Sim_LcdDrain();
+      Sim_ReportLcd("LCD, next pass ");
+      Sim_LcdRender();
+}
+
+static void Sim_ProbeScreen(void)
+{
+      printf("t=%5u ms  state=%u\n",Sim_NowMs(),ProgramState);
+      Sim_LcdRender();
+}
+
+static void Sim_ScenarioDemo(void)
+{
+      uint8 _Index;
+
+      Sim_BoardReset();
+      /* Any key wakes the oven from APP_OFF_STATE */
+      Sim_ScheduleKeyPress(100,0,0);
+      /* '#' five times to reach the last digit of seconds, then '5' */
+      for(_Index=0; _Index<5; _Index++) Sim_ScheduleKeyPress(800+_Index*300,3,2);
+      Sim_ScheduleKeyPress(2300,1,1);
+      /* Start, look at the countdown, then cancel the notification */
+      Sim_ScheduleInput(2700,SIM_PORTB,PIN_3,LOW);
+      Sim_ScheduleInput(2700+SIM_PRESS_MS,SIM_PORTB,PIN_3,HIGH);
+      Sim_ScheduleProbe(4000,Sim_ProbeScreen);
+      Sim_ScheduleProbe(8000,Sim_ProbeScreen);
+      Sim_ScheduleInput(8500,SIM_PORTB,PIN_4,LOW);
+      Sim_ScheduleInput(8500+SIM_PRESS_MS,SIM_PORTB,PIN_4,HIGH);
+
+      Sim_RunFirmware(Firmware_main,9000);
+      Sim_ProbeScreen();
+      printf("  wakeups %u, interrupts %u, asleep %.1f %%\n",
+             Sim_Stats.wakeups,Sim_Stats.interrupts,
+             100.0*(double)Sim_Stats.sleepCycles/(double)Sim_Stats.cycles);
+      Sim_ReportLcd("LCD, whole run");
+}
+
+static void Sim_ProbeWakeMark(void)
+{
+      if(Sim_WakeMarks < 2*SIM_WAKE_SEGMENTS)
+      {
+            Sim_WakeCycles[Sim_WakeMarks]=Sim_Stats.cycles;
+            Sim_WakeSleepCycles[Sim_WakeMarks]=Sim_Stats.sleepCycles;
+            Sim_WakeDeepCycles[Sim_WakeMarks]=Sim_Stats.deepSleepCycles;
+            Sim_WakeTimer0[Sim_WakeMarks]=Sim_Stats.timer0Overflows;
+            Sim_WakeTimer1[Sim_WakeMarks]=Sim_Stats.timer1Overflows;
+            Sim_WakeCount[Sim_WakeMarks++]=Sim_Stats.wakeups;
+      }
+}
+
+static void Sim_ProbeSetTime(void)
+{
+      App_Time.minutes=1; /* Cook through the Run minute, then notify */
+      App_Time.seconds=3;
+}
+
+static void Sim_ScenarioKeypadScan(void)
+{
+      Sim_BoardReset();
+      Keypad_init(&Keypad1);
+      Sim_SetKey(1,1,TRUE);  /* '5' held, the scan result doesn't change the cost */
+
+      Sim_ResetCounters();
+      Keypad_update(&Keypad1);
+      Sim_ReportCounters("SFR accesses of one Keypad_update() scan (4x3):");
+}
+
+/* LATB and LATC hold bits of pins not configured yet (buzzer off, lamp */
+/* on), the first shadowed writes of the heater and the motor keep them  */
+static void Sim_ScenarioGpioShadow(void)
+{
+      static HAL_GPIO_DeviceType _Heater={HEATER_PIN,OUTPUT};
+      static HAL_GPIO_DeviceType _Motor ={MOTOR_PIN,OUTPUT};
+      uint8 _LatB;
+      uint8 _LatC;
+
+      Sim_Reset();
+      HAL_RegisterWrite(PORTB_BASE_ADDRESS+PORT_LATCH_OFFSET,0x40);
+      HAL_RegisterWrite(PORTC_BASE_ADDRESS+PORT_LATCH_OFFSET,0x02);
+      GPIO_DeviceInit(&_Heater);
+      GPIO_DeviceInit(&_Motor);
+      GPIO_PIN_SET(HEATER_PIN);
+      GPIO_PIN_SET(MOTOR_PIN);
+      _LatB=Sim_RegisterRead(PORTB_BASE_ADDRESS+PORT_LATCH_OFFSET);
+      _LatC=Sim_RegisterRead(PORTC_BASE_ADDRESS+PORT_LATCH_OFFSET);
+      printf("  LATB %02X (expected C0), LATC %02X (expected 06)\n",_LatB,_LatC);
+      if(_LatB != 0xC0 || _LatC != 0x06)
+      {
+            printf("  FAIL: a shadowed write cleared latch bits of other pins\n");
+            Sim_ExitStatus=1;
+      }
+}
+
+/* Taps shorter than an Edit pass apart, every one must move the cursor */
+static void Sim_ScenarioKeypadBurst(void)
+{
+      uint8 _Index;
+
+      Sim_BoardReset();
+      Sim_ScheduleKeyPress(100,0,0);  /* Wake up */
+      for(_Index=0; _Index<SIM_BURST_TAPS; _Index++)
+      {
+            Sim_ScheduleKey(1000+_Index*2UL*SIM_BURST_MS,3,2,TRUE);
+            Sim_ScheduleKey(1000+_Index*2UL*SIM_BURST_MS+SIM_BURST_MS,3,2,FALSE);
+      }
+
+      Sim_RunFirmware(Firmware_main,1000+2UL*SIM_BURST_MS*SIM_BURST_TAPS+500);
+      printf("  %u taps of %u ms, Edit_Position %u (expected %u), events lost %u\n",
+             SIM_BURST_TAPS,SIM_BURST_MS,Edit_Position,SIM_BURST_TAPS%6,Keypad1.eventsLost);
+}
+
+/* One minute of every state, each segment starts 1 s after its input */
+static void Sim_ScenarioWakeRate(void)
+{
+      uint32 _Start;
+      uint8 _Index;
+      double _Time;
+      double _Awake;
+      double _Deep;
+      double _Seconds;
+
+      Sim_BoardReset();
+      Sim_WakeMarks=0;
+      Sim_ScheduleKeyPress(100,0,0);  /* Wake up */
+      _Start=1000;
+      Sim_ScheduleProbe(_Start,Sim_ProbeWakeMark);
+      Sim_ScheduleProbe(_Start+SIM_MINUTE_MS,Sim_ProbeWakeMark);
+      _Start+=SIM_MINUTE_MS;
+      for(_Index=0; _Index<60; _Index++) Sim_ScheduleKeyPress(_Start+500+_Index*1000UL,3,2);
+      Sim_ScheduleProbe(_Start,Sim_ProbeWakeMark);
+      Sim_ScheduleProbe(_Start+SIM_MINUTE_MS,Sim_ProbeWakeMark);
+      _Start+=SIM_MINUTE_MS;
+      Sim_ScheduleProbe(_Start,Sim_ProbeSetTime);
+      Sim_ScheduleInput(_Start,SIM_PORTB,PIN_3,LOW);   /* Start */
+      Sim_ScheduleInput(_Start+SIM_PRESS_MS,SIM_PORTB,PIN_3,HIGH);
+      Sim_ScheduleProbe(_Start+1000,Sim_ProbeWakeMark);
+      Sim_ScheduleProbe(_Start+1000+SIM_MINUTE_MS,Sim_ProbeWakeMark);
+      _Start+=1000+SIM_MINUTE_MS;
+      /* The countdown ends 2 s later, the buzzer toggles */
+      Sim_ScheduleProbe(_Start+3000,Sim_ProbeWakeMark);
+      Sim_ScheduleProbe(_Start+3000+SIM_MINUTE_MS,Sim_ProbeWakeMark);
+      _Start+=3000+SIM_MINUTE_MS;
+      Sim_ScheduleInput(_Start,SIM_PORTB,PIN_5,LOW);   /* Power Off */
+      Sim_ScheduleInput(_Start+SIM_PRESS_MS,SIM_PORTB,PIN_5,HIGH);
+      Sim_ScheduleProbe(_Start+1000,Sim_ProbeWakeMark);
+      Sim_ScheduleProbe(_Start+1000+SIM_MINUTE_MS,Sim_ProbeWakeMark);
+      _Start+=1000+SIM_MINUTE_MS;
+
+      Sim_RunFirmware(Firmware_main,_Start+1);
+      printf("  APP_INPUT_WAKE=%u\n",APP_INPUT_WAKE);
+      printf("  %-22s %12s %10s %10s %10s %10s %8s\n","state","wakeups/min","wakeups/s",
+             "Timer0/s","Timer1/s","awake %","est. uA");
+      for(_Index=0; _Index<SIM_WAKE_SEGMENTS; _Index++)
+      {
+            _Time =(double)(Sim_WakeCycles[2*_Index+1]-Sim_WakeCycles[2*_Index]);
+            _Awake=_Time-(double)(Sim_WakeSleepCycles[2*_Index+1]-Sim_WakeSleepCycles[2*_Index]);
+            _Deep =(double)(Sim_WakeDeepCycles[2*_Index+1]-Sim_WakeDeepCycles[2*_Index]);
+            _Seconds=_Time/SIM_CYCLES_PER_MS/1000.0;
+            printf("  %-22s %12u %10.1f %10.1f %10.1f %10.3f %8.0f\n",Sim_WakeSegments[_Index],
+                   Sim_WakeCount[2*_Index+1]-Sim_WakeCount[2*_Index],
+                   (Sim_WakeCount[2*_Index+1]-Sim_WakeCount[2*_Index])/_Seconds,
+                   (Sim_WakeTimer0[2*_Index+1]-Sim_WakeTimer0[2*_Index])/_Seconds,
+                   (Sim_WakeTimer1[2*_Index+1]-Sim_WakeTimer1[2*_Index])/_Seconds,
+                   100.0*_Awake/_Time,
+                   (_Awake*SIM_RUN_UA+(_Time-_Awake-_Deep)*SIM_IDLE_UA+_Deep*SIM_SLEEP_UA)/_Time);
+      }
+}
+
+/* Init and WakeUp layout with LCDs of other clocks, the execution times */
+/* scale with 1/fosc (10 clocks a byte, 410 clear display). The busy    */
+/* flag reads and their R/W HIGH time are the layout ones, exit 1 on an */
+/* LCD timing violation.                                                */
+static void Sim_ScenarioLcdThroughput(void)
+{
+      static const uint32 _FoscKhz[]={190,270,350,500};
+      uint64 _Start;
+      uint64 _Init;
+      uint32 _Violations;
+      uint8 _Index;
+
+      printf("  LCD_RW_WIRED=%u, LCDQUEUE_PERIOD_US=%u\n",LCD_RW_WIRED,LCDQUEUE_PERIOD_US);
+      printf("  %-10s %10s %12s %14s %11s %9s\n","LCD fosc","init ms","layout ms","interrupt us",
+             "busy reads","poll us");
+      for(_Index=0; _Index<sizeof(_FoscKhz)/sizeof(_FoscKhz[0]); _Index++)
+      {
+            Sim_LcdSetExecution(10000000UL/_FoscKhz[_Index],410000000UL/_FoscKhz[_Index]);
+            Sim_BoardReset();
+            APP_Init();
+            Sim_LcdDrain();
+            _Init=Sim_Now();
+            _Violations=Sim_LcdViolations();
+            Sim_LcdResetStats();
+            _Start=Sim_Now();
+            Sim_PassStart();
+            APP_WakeUp_Mode();
+            Sim_LcdDrain();
+            printf("  %4u kHz   %10.2f %12.2f %14.1f %11u %9.1f\n",_FoscKhz[_Index],
+                   (double)_Init/SIM_CYCLES_PER_MS,(double)(Sim_Now()-_Start)/SIM_CYCLES_PER_MS,
+                   (double)(Sim_Stats.isrCycles-Sim_PassIsrCycles)/SIM_CYCLES_PER_US,
+                   Sim_LcdStats.busyReads,(double)Sim_LcdStats.pollCycles/SIM_CYCLES_PER_US);
+            if(_Violations+Sim_LcdViolations() != 0)
+            {
+                  printf("  FAIL: %u LCD timing violations\n",_Violations+Sim_LcdViolations());
+                  Sim_ExitStatus=1;
+            }
+      }
+      Sim_LcdSetExecution(SIM_LCD_BYTE_NS,SIM_LCD_CLEAR_NS);
+}
+
+/* Send the frame, report it and check the glass and the bus timing */
+static void Sim_LcdFrameEnd(const char * title, const char * const * screen)
+{
+      char  _Line[SIM_LCD_COLUMNS+1];
+      uint8 _Row;
+
+      Sim_LcdDrain();
+      Sim_LcdReport(title);
+      if(Sim_LcdViolations() != 0)      Sim_ExitStatus=1;
+      for(_Row=0; _Row<SIM_LCD_ROWS; _Row++)
+      {
+            Sim_LcdGetRow(_Row,_Line);
+            if(strcmp(_Line,screen[_Row]) != 0)
+            {
+                  printf("    row %u is \"%s\", expected \"%s\"\n",_Row+1,_Line,screen[_Row]);
+                  Sim_ExitStatus=1;
+            }
+      }
+      Sim_LcdResetStats();
+}
+
+/* Every screen update of a wake up as one frame, the exit status is 1 if */
+/* a screen is wrong or the LCD timing is violated                        */
+static void Sim_ScenarioLcdFrame(void)
+{
+      static const char * const _Blank[SIM_LCD_ROWS]={
+              "                ","                ","                ","                "};
+      static const char * const _Layout[SIM_LCD_ROWS]={
+              "Time:           ","Microwave:Edit  ","Door:    Food:  ","Error:          "};
+      static const char * const _Edit[SIM_LCD_ROWS]={
+              "Time:00:00:00   ","Microwave:Edit  ","Door:OK  Food:OK","Error:          "};
+      static const char * const _Tick[SIM_LCD_ROWS]={
+              "Time:00:00:01   ","Microwave:Edit  ","Door:OK  Food:OK","Error:          "};
+      static const char * const _Full[SIM_LCD_ROWS]={
+              "0123456789ABCDEF","FEDCBA9876543210","abcdefghijklmnop","ponmlkjihgfedcba"};
+      Time_DataType _Time={1,0,0};
+      uint8 _Row;
+      uint8 _Free;
+
+      Sim_BoardReset();
+      APP_Init();
+      Sim_LcdFrameEnd("Init: Hd44780_init and clear",_Blank);
+      APP_WakeUp_Mode();
+      Sim_LcdFrameEnd("Frame: APP_WakeUp_Mode layout",_Layout);
+      APP_Edit_Mode();
+      Sim_LcdFrameEnd("Frame: first APP_Edit_Mode pass",_Edit);
+      APP_Timeupdate(&_Time);
+      LcdBuffer_flush();
+      Sim_LcdFrameEnd("Frame: one second of the time",_Tick);
+      /* Two full screens queued with interrupts off: the second doesn't fit, */
+      /* its other cells wait for the next flush                               */
+      InterruptHandler_DisableGlobalInterrupt();
+      for(_Row=1; _Row<=SIM_LCD_ROWS; _Row++)      LcdBuffer_out(_Row,1,"################");
+      LcdBuffer_flush();
+      for(_Row=1; _Row<=SIM_LCD_ROWS; _Row++)      LcdBuffer_out(_Row,1,(char *)_Full[_Row-1]);
+      LcdBuffer_flush();
+      _Free=LcdQueue_getFree();
+      InterruptHandler_EnbleGlobalInterrupt();
+      Sim_LcdDrain();
+      LcdBuffer_flush();
+      printf("  queue full: %u entries free after two screens\n",_Free);
+      if(_Free >= 2)      Sim_ExitStatus=1;
+      Sim_LcdFrameEnd("Frame: two screens through a full queue",_Full);
+      Sim_LcdRender();
+      printf("  %s\n",Sim_ExitStatus ? "FAILED" : "screens and timing OK");
+}
+
+/* A full sleep (IDLEN clear) stops Timer2, the queued bytes would wait */
+/* for the next wake up                                                  */
+static void Sim_LcdSleepChecked(void)
+{
+      if(LcdQueue_isEmpty() == TRUE)      return;
+      Sim_LcdSleeps++;
+      if(OSCCON.IDLEN == 0)      Sim_LcdStuckSleeps++;
+}
+
+static void Sim_ProbeLcdBlank(void)
+{
+      static const char _Blank[SIM_LCD_COLUMNS+1]="                ";
+      char  _Line[SIM_LCD_COLUMNS+1];
+      uint8 _Row;
+
+      printf("  t=%u ms: state %u\n",Sim_NowMs(),ProgramState);
+      for(_Row=0; _Row<SIM_LCD_ROWS; _Row++)
+      {
+            Sim_LcdGetRow(_Row,_Line);
+            if(strcmp(_Line,_Blank) != 0)
+            {
+                  printf("    row %u is \"%s\", expected blank\n",_Row+1,_Line);
+                  Sim_ExitStatus=1;
+            }
+      }
+}
+
+/* Wake, edit, cook, then Power Off: the frames queued right before a */
+/* sleep must still be sent, the OFF screen is blank 100 ms later. The */
+/* exit status is 1 if the core fully slept with bytes queued.         */
+static void Sim_ScenarioLcdSleep(void)
+{
+      uint8 _Index;
+
+      Sim_BoardReset();
+      Sim_LcdSleeps=0;
+      Sim_LcdStuckSleeps=0;
+      Sim_SetSleepHook(Sim_LcdSleepChecked);
+      Sim_ScheduleKeyPress(100,0,0);  /* Wake up */
+      for(_Index=0; _Index<5; _Index++) Sim_ScheduleKeyPress(800+_Index*300,3,2);
+      Sim_ScheduleKeyPress(2300,1,1);
+      Sim_ScheduleInput(2700,SIM_PORTB,PIN_3,LOW);   /* Start */
+      Sim_ScheduleInput(2700+SIM_PRESS_MS,SIM_PORTB,PIN_3,HIGH);
+      Sim_ScheduleInput(4000,SIM_PORTB,PIN_5,LOW);   /* Power Off */
+      Sim_ScheduleInput(4000+SIM_PRESS_MS,SIM_PORTB,PIN_5,HIGH);
+      Sim_ScheduleProbe(4000+SIM_PRESS_MS+100,Sim_ProbeLcdBlank);
+
+      Sim_RunFirmware(Firmware_main,5000);
+      Sim_SetSleepHook(NULL_PTR);
+      printf("  sleeps with LCD bytes queued %u, full sleeps among them %u\n",
+             Sim_LcdSleeps,Sim_LcdStuckSleeps);
+      if(Sim_LcdStuckSleeps != 0 || ProgramState != APP_OFF_STATE)
+      {
+            printf("  FAIL: LCD bytes stayed queued across a full sleep\n");
+            Sim_ExitStatus=1;
+      }
+}
+
+/* Host entry point */
+static void Sim_ProbeSetCountdown(void)
+{
+      App_Time.hours=SIM_BCD(SIM_COUNTDOWN_HOURS);
+      App_Time.minutes=0;
+      App_Time.seconds=0;
+}
+
+/* Cooking: the countdown must end whole ticks of 500 ms after the last one.*/
+/* The second timer is the only running one, so the head of the list: its  */
+/* delta are the ticks left of this second.                                */
+static void Sim_ProbeDriftStart(void)
+{
+      uint64 _End;
+
+      Sim_DriftOverflows=Sim_Stats.timer1Overflows;
+      Sim_DriftCycle=Sim_Stats.timer1OverflowCycle;
+      Sim_DriftTicks=(SIM_BCD_VALUE(App_Time.hours)*3600+SIM_BCD_VALUE(App_Time.minutes)*60+
+                      SIM_BCD_VALUE(App_Time.seconds)-1)*
+                     APP_SECOND_TICKS+App_SecondTimer.delta-
+                     (uint32)App_SecondTimer.expirations*APP_SECOND_TICKS;
+      _End=Sim_DriftCycle+Sim_DriftTicks*SIM_TICK_CYCLES;
+      /* Half a tick after the expected end, Timer0 over the 10 s before it */
+      Sim_ScheduleProbe((uint32)(_End/SIM_CYCLES_PER_MS)+SIM_TICK_MS/2,Sim_ProbeDriftEnd);
+      Sim_ScheduleKey((uint32)(_End/SIM_CYCLES_PER_MS)-11500,0,0,TRUE);
+      Sim_ScheduleProbe((uint32)(_End/SIM_CYCLES_PER_MS)-11000,Sim_ProbeDriftTimer0Start);
+      Sim_ScheduleProbe((uint32)(_End/SIM_CYCLES_PER_MS)-1000,Sim_ProbeDriftTimer0);
+      Sim_ScheduleKey((uint32)(_End/SIM_CYCLES_PER_MS)-500,0,0,FALSE);
+      printf("  t=%u ms: state %u, %02X:%02X:%02X left = %u ticks\n",Sim_NowMs(),ProgramState,
+             App_Time.hours,App_Time.minutes,App_Time.seconds,Sim_DriftTicks);
+}
+
+/* Cooking Timer0 is stretched up to the sensor poll, a held key (unused */
+/* while cooking) keeps it on the 25 ms tick: from the key settled on, the */
+/* additive reload must keep its overflows on whole periods.               */
+static void Sim_ProbeDriftTimer0Start(void)
+{
+      Sim_DriftOverflows0=Sim_Stats.timer0Overflows;
+      Sim_DriftCycle0=Sim_Stats.timer0OverflowCycle;
+}
+
+static void Sim_ProbeDriftTimer0(void)
+{
+      uint32 _Ticks=Sim_Stats.timer0Overflows-Sim_DriftOverflows0;
+      uint64 _Cycles=Sim_Stats.timer0OverflowCycle-Sim_DriftCycle0;
+      double _Drift=(double)_Cycles-(double)_Ticks*TIMER0_CONFIG_PERIOD_TCY;
+
+      printf("  Timer0: ticks %u, tick %.3f us (nominal %u us), drift %.3f ms\n",_Ticks,
+             (double)_Cycles/_Ticks/SIM_CYCLES_PER_US,(uint32)TIMER0_CONFIG_PERIOD_US,
+             _Drift/SIM_CYCLES_PER_MS);
+      if(_Drift != 0 || ProgramState != APP_RUNNING_STATE)
+      {
+            printf("  FAIL: the Timer0 ticks aren't whole periods under a held key\n");
+            Sim_ExitStatus=1;
+      }
+}
+
+static void Sim_ProbeDriftEnd(void)
+{
+      uint32 _Ticks=Sim_Stats.timer1Overflows-Sim_DriftOverflows;
+      uint64 _Cycles=Sim_Stats.timer1OverflowCycle-Sim_DriftCycle;
+      double _Drift=(double)_Cycles-(double)_Ticks*SIM_TICK_CYCLES;
+
+      Sim_DriftChecked=TRUE;
+      printf("  t=%u ms: state %u, %02X:%02X:%02X left\n",Sim_NowMs(),ProgramState,
+             App_Time.hours,App_Time.minutes,App_Time.seconds);
+      printf("  ticks %u (expected %u), tick %.3f us (nominal %u us)\n",_Ticks,Sim_DriftTicks,
+             (double)_Cycles/_Ticks/SIM_CYCLES_PER_US,SIM_TICK_MS*1000);
+      printf("  timebase drift %.3f ms = %.2f ticks, countdown error %d ticks\n",
+             _Drift/SIM_CYCLES_PER_MS,_Drift/SIM_TICK_CYCLES,(int)(_Ticks-Sim_DriftTicks));
+      if(_Ticks != Sim_DriftTicks || ProgramState != APP_NOTIFICATION_STATE)
+      {
+            printf("  FAIL: the countdown is not within one tick of %u h\n",SIM_COUNTDOWN_HOURS);
+            Sim_ExitStatus=1;
+      }
+}
+
+/* Cook 99:00:00, the Timer2 LCD interrupts and the main loop delay the */
+/* Timer1 interrupt, the reload must not add these latencies to the time */
+static void Sim_ScenarioTimebaseDrift(void)
+{
+      Sim_BoardReset();
+      Sim_DriftChecked=FALSE;
+      Sim_ScheduleKeyPress(100,0,0);  /* Wake up */
+      Sim_ScheduleProbe(1000,Sim_ProbeSetCountdown);
+      Sim_ScheduleInput(1000,SIM_PORTB,PIN_3,LOW);   /* Start */
+      Sim_ScheduleInput(1000+SIM_PRESS_MS,SIM_PORTB,PIN_3,HIGH);
+      Sim_ScheduleProbe(2000,Sim_ProbeDriftStart);
+
+      Sim_RunFirmware(Firmware_main,3000+SIM_COUNTDOWN_HOURS*SIM_HOUR_MS);
+      printf("  wakeups %u, interrupts %u, ISR %.3f s\n",Sim_Stats.wakeups,Sim_Stats.interrupts,
+             (double)Sim_Stats.isrCycles/SIM_CYCLES_PER_MS/1000);
+      if(Sim_DriftChecked == FALSE)
+      {
+            printf("  FAIL: the countdown didn't end\n");
+            Sim_ExitStatus=1;
+      }
+}
+
+/* A 20 us glitch on RB4 (too short for the debouncer) Sim_GlitchLead */
+/* cycles before the next Timer0 overflow: its RB interrupt is running  */
+/* when the tick comes                                                  */
+static void Sim_ProbeGlitchAtTick(void)
+{
+      uint64 _Tick=Sim_Timer0NextOverflow();
+
+      if(_Tick == 0 || _Tick < Sim_Now()+Sim_GlitchLead) return; /* No tick */
+      Sim_ScheduleInputCycle(_Tick-Sim_GlitchLead,SIM_PORTB,PIN_4,LOW);
+      Sim_ScheduleInputCycle(_Tick-Sim_GlitchLead+20*SIM_CYCLES_PER_US,SIM_PORTB,PIN_4,HIGH);
+      Sim_GlitchLead++;
+}
+
+/* Keys typed fast in Edit: the Timer0 tick, the keypad columns, RB      */
+/* changes and the LCD bytes compete. Then RB glitches swept 0..39 Tcy   */
+/* before the ticks and the Timer1 crystal while cooking.                */
+static void Sim_ScenarioIrqLatency(void)
+{
+      static const struct{
+              const char * name;
+              uint16       address;
+              uint8        bitNo;
+      }_Sources[]={
+              {"TMR0",SIM_INTCON_ADDRESS,2}, {"TMR1",SIM_PIR1_ADDRESS,0},
+              {"INT0",SIM_INTCON_ADDRESS,1}, {"INT1",SIM_INTCON3_ADDRESS,0},
+              {"INT2",SIM_INTCON3_ADDRESS,1},{"RB",SIM_INTCON_ADDRESS,0},
+              {"TMR2",SIM_PIR1_ADDRESS,1}
+      };
+      uint32 _Latency;
+      uint8 _Index;
+
+      Sim_BoardReset();
+      Sim_ScheduleKeyPress(100,0,0);
+      for(_Index=0; _Index<20; _Index++) Sim_ScheduleKeyPress(800+_Index*120,_Index%4,_Index%3);
+      Sim_GlitchLead=0;
+      for(_Index=0; _Index<40; _Index++) Sim_ScheduleProbe(3500+_Index*300,Sim_ProbeGlitchAtTick);
+      Sim_ScheduleKeyPress(15500,1,1);
+      Sim_ScheduleInput(15900,SIM_PORTB,PIN_3,LOW);
+      Sim_ScheduleInput(15900+SIM_PRESS_MS,SIM_PORTB,PIN_3,HIGH);
+      Sim_ScheduleInput(21500,SIM_PORTB,PIN_4,LOW);
+      Sim_ScheduleInput(21500+SIM_PRESS_MS,SIM_PORTB,PIN_4,HIGH);
+
+      Sim_RunFirmware(Firmware_main,22000);
+      printf("  APP_INTERRUPT_PRIORITY=%u, %u interrupts, %u of them low priority\n",
+             APP_INTERRUPT_PRIORITY,Sim_Stats.interrupts,Sim_Stats.lowInterrupts);
+      printf("  %-8s %10s %10s\n","vector","worst Tcy","worst us");
+      printf("  %-8s %10u %10.1f\n","high",Sim_Stats.highLatencyMax,
+             (double)Sim_Stats.highLatencyMax/SIM_CYCLES_PER_US);
+      printf("  %-8s %10u %10.1f\n","low",Sim_Stats.lowLatencyMax,
+             (double)Sim_Stats.lowLatencyMax/SIM_CYCLES_PER_US);
+      printf("  %-8s %10s %10s\n","source","worst Tcy","worst us");
+      for(_Index=0; _Index<sizeof(_Sources)/sizeof(_Sources[0]); _Index++)
+      {
+            _Latency=Sim_LatencyMax(_Sources[_Index].address,_Sources[_Index].bitNo);
+            printf("  %-8s %10u %10.1f\n",_Sources[_Index].name,_Latency,
+                   (double)_Latency/SIM_CYCLES_PER_US);
+      }
+}
+
+#if PROFILE_ENABLE
+/* Serial port of the dump */
+static void Sim_ProfilePut(char Character)
+{
+      if(Character != '\r') putchar(Character);
+}
+#endif
+
+/* The demo inputs with the probes, the ISR count and time of the       */
+/* profiler are checked against the simulator                           */
+static void Sim_ScenarioProfile(void)
+{
+#if PROFILE_ENABLE
+      Profile_HistogramType _Isr;
+      Profile_HistogramType _IsrLow;
+      uint8 _Index;
+
+      Sim_BoardReset();
+      Sim_ScheduleKeyPress(100,0,0);
+      for(_Index=0; _Index<5; _Index++) Sim_ScheduleKeyPress(800+_Index*300,3,2);
+      Sim_ScheduleKeyPress(2300,1,1);
+      Sim_ScheduleInput(2700,SIM_PORTB,PIN_3,LOW);
+      Sim_ScheduleInput(2700+SIM_PRESS_MS,SIM_PORTB,PIN_3,HIGH);
+      Sim_ScheduleInput(8500,SIM_PORTB,PIN_4,LOW);
+      Sim_ScheduleInput(8500+SIM_PRESS_MS,SIM_PORTB,PIN_4,HIGH);
+
+      Sim_RunFirmware(Firmware_main,9000);
+      Profile_dump(Sim_ProfilePut);
+      Profile_getHistogram(PROFILE_HISTOGRAM_ISR,&_Isr);
+      Profile_getHistogram(PROFILE_HISTOGRAM_ISR_LOW,&_IsrLow);
+      printf("  simulator: %u interrupts (%u low), %.1f Tcy mean in the routines with the vectoring\n",
+             Sim_Stats.interrupts,Sim_Stats.lowInterrupts,
+             (double)Sim_Stats.isrCycles/Sim_Stats.interrupts);
+      if(_Isr.stats.calls+_IsrLow.stats.calls != Sim_Stats.interrupts
+         || _IsrLow.stats.calls != Sim_Stats.lowInterrupts)
+      {
+            printf("  FAIL: the profiler saw %u+%u interrupts\n",_Isr.stats.calls,_IsrLow.stats.calls);
+            Sim_ExitStatus=1;
+      }
+#else
+      printf("  PROFILE_ENABLE is FALSE, the probes are compiled out (make profile)\n");
+#endif
+}
+
+int main(int argc, char * argv[])
+{
+      uint8 _Index;
+      const char * _Name=(argc > 1) ? argv[1] : Sim_Scenarios[0].name;
+
+      for(_Index=0; _Index<sizeof(Sim_Scenarios)/sizeof(Sim_Scenarios[0]); _Index++)
+      {
+            if(strcmp(_Name,Sim_Scenarios[_Index].name)==0)
+            {
+                  printf("== %s: %s\n",Sim_Scenarios[_Index].name,Sim_Scenarios[_Index].description);
+                  Sim_Scenarios[_Index].run();
+                  return Sim_ExitStatus;
+            }
+      }
+      printf("usage: %s [scenario]\n",argv[0]);
+      for(_Index=0; _Index<sizeof(Sim_Scenarios)/sizeof(Sim_Scenarios[0]); _Index++)
+      {
+            printf("  %-12s %s\n",Sim_Scenarios[_Index].name,Sim_Scenarios[_Index].description);
+      }
+      return 1;
+}
@@ -17,9 +17,43 @@
 #include "StdTypes.h"
 #include "HAL.h"
 #include "Module_Keypad.h"
+#include "Module_SoftTimer.h"
 
 /* Macros */
 #define Sleep() _asm sleep  /* Sleep the controller */
+/* Timer0 tick (Timer0_Config.h): debounce and keypad scan while an input */
+/* is moving                                                               */
+#define APP_TICK_MS         (TIMER0_CONFIG_PERIOD_US/1000)
+/* Software timers count Timer1 ticks. Its 32.768 kHz crystal counts in     */
+/* sleep and wakes the CPU every APP_RTC_TICK_MS in Run and Notification.   */
+#define APP_RTC_TICK_MS     500
+#define APP_RTC_RELOAD      (65536-APP_RTC_TICK_MS*TIMER1_OSCILLATOR_HZ/1000)
+#define APP_SECOND_TICKS    (1000/APP_RTC_TICK_MS)  /* Countdown */
+#define APP_BUZZER_TICKS    (500/APP_RTC_TICK_MS)   /* Buzzer toggle */
+#if (APP_RTC_RELOAD & 0xFF) != 0
+#error "APP_RTC_TICK_MS isn't whole TMR1H counts, the reload can't be exact"
+#endif
+/* While no input is moving the keypad (INT0..INT2) and RB4..RB7 changes    */
+/* wake the CPU. Start (RB3) and the sensors (PORTA) have no change         */
+/* interrupt: polled every APP_POLL_TICKS, a change is debounced by the    */
+/* 25 ms tick up to its settle. FALSE => all inputs polled by the tick.     */
+#ifndef APP_INPUT_WAKE
+#define APP_INPUT_WAKE TRUE
+#endif
+/* Interrupt priority (IPEN): the Timer0 tick, which samples the door and  */
+/* weight sensors, and the Timer1 crystal go on high priority. Keypad      */
+/* columns INT1/INT2, the buttons (RB), the LCD bytes (Timer2) and the     */
+/* unused UART go on low. INT0 is always high. FALSE => one vector.        */
+#ifndef APP_INTERRUPT_PRIORITY
+#define APP_INTERRUPT_PRIORITY TRUE
+#endif
+/* Tickless idle: in Edit, Run and Notification one Timer0 period is      */
+/* extended up to the poll, TIMER0_CONFIG_MAX_PERIOD_US, the seconds and  */
+/* the buzzer are Timer1's. Timer0 stops in OFF only.                     */
+#define APP_POLL_TICKS      (TIMER0_CONFIG_MAX_PERIOD_US/TIMER0_CONFIG_PERIOD_US)
+#if (APP_POLL_TICKS*TIMER0_CONFIG_PERIOD_US) != TIMER0_CONFIG_MAX_PERIOD_US
+#error "TIMER0_CONFIG_MAX_PERIOD_US must be whole Timer0 ticks"
+#endif
 
 /* Defined data types */
 /*****************************************************************************/
@@ -47,18 +81,20 @@ typedef enum {
 }APP_stateType;
 
 /*****************************************************************************/
-/** Description: This is to define Time data.                               **/
+/** Description: This is to define Time data, every field is packed BCD    **/
+/**              (tens in the high nibble) so no division runs to edit,     **/
+/**              count down or print it.                                    **/
 /**                                                                         **/
 /** Type: Structure.                                                        **/
 /**                                                                         **/
-/** Elements: - seconds                                                     **/
-/**           - minutes                                                     **/
-/**           - hours                                                       **/
+/** Elements: - seconds => 0x00..0x59                                       **/
+/**           - minutes => 0x00..0x59                                       **/
+/**           - hours   => 0x00..0x99                                       **/
 /*****************************************************************************/
 typedef struct{
-       sint8 seconds;
-       sint8 minutes;
-       sint8 hours;
+       uint8 seconds;
+       uint8 minutes;
+       uint8 hours;
 }Time_DataType;
 
 /* Function defination */
@@ -70,12 +106,20 @@ typedef struct{
 void APP_Init(void);
 
 /**
-  * @brief	This function to update the time on screen. 
-  *	@param	None.
+  * @brief	This function to update the time on screen, one nibble per digit. 
+  *	@param	Time_Data Pointer to the BCD time.
   *	@return	None.
   */
 void APP_Timeupdate(Time_DataType * Time_Data);
 
+/**
+  * @brief	This function counts the BCD time down by one second, 00:00:00 
+  *			stays at 00:00:00. 
+  *	@param	Time_Data Pointer to the BCD time.
+  *	@return	TRUE if the time is 00:00:00 after the call, FALSE otherwise.
+  */
+uint8 APP_TimeDecrement(Time_DataType * Time_Data);
+
 /**
   * @brief	This function contains all needed processes for OFF Mode. 
   *	@param	None.
@@ -90,6 +134,32 @@ void APP_Off_Mode(void);
   */
 void APP_WakeUp_Mode(void);
 
+/**
+  * @brief	This function arms the input change wake when no input is moving 
+  *			in Edit, Run or Notification Mode and disarms it when an input 
+  *			changed. 
+  *	@param	None.
+  *	@return	None.
+  */
+void APP_InputWake_Update(void);
+
+/**
+  * @brief	This function disarms the input change wake, an extended 
+  *			Timer0 is back to one tick. 
+  *	@param	None.
+  *	@return	None.
+  */
+void APP_InputWake_Stop(void);
+
+/**
+  * @brief	This function extends the Timer0 period which runs now up to the 
+  *			next poll in Edit, Run or Notification Mode before it sleeps 
+  *			(tickless idle). 
+  *	@param	None.
+  *	@return	None.
+  */
+void APP_Tickless_Update(void);
+
 /**
   * @brief	This function contains all needed processes for Edit Mode. 
   *	@param	None.
@@ -16,15 +16,44 @@
 #include "StdTypes.h"
 #include "HAL.h"
 #include "Module_Keypad.h"
-#include "Lcd_Config.h" /* contain all configurauins of LCD */
+#include "Module_LcdQueue.h"
+#include "Module_Profile.h"
 #include "Keypad_Config.h" /* contain all configurauins of Keypad */
-#include "App_Functions.h" /* contain app functions */
+#include "APP_Functions.h" /* contain app functions */
 
 
 /* Externed variables */
 extern APP_stateType ProgramState;  /* Extern from APP_Function.c */
-extern uint8 TimerIntCounter;  /* Extern from APP_Function.c */
-extern HAL_Timer0_ConfigType Timer0_Configurations; /* Extern from APP_Function.c */
+extern uint8 InputChangeFlag;  /* Extern from APP_Function.c */
+extern uint8 AppEventFlag;     /* Extern from APP_Function.c */
+extern uint8 App_TickPeriod;   /* Extern from APP_Function.c */
+extern HAL_Timer1_ConfigType Timer1_Configurations; /* Extern from APP_Function.c */
+
+/* Macros */
+/* An input interrupt wakes up from APP_OFF_STATE, else it leaves the idle tick */
+#define APP_INPUT_CHANGED()  \
+do{ if(ProgramState==APP_OFF_STATE) ProgramState=APP_WAKE_UP_STATE; \
+    else                            InputChangeFlag=TRUE;           \
+    AppEventFlag=TRUE; }while(0)
+
+/* Sleep until an interrupt of the app, the LCD byte periods (Timer2) only */
+/* send queued bytes and don't start a new pass. AppEventFlag is cleared  */
+/* at the top of the pass and checked with GIE clear: an event of the     */
+/* pass isn't lost and none comes between the check and SLEEP. An enabled */
+/* flag wakes the core with GIE clear, its routine runs once GIE is set.  */
+/* IDLEN: idle while Timer0 runs or LCD bytes are queued, both need the   */
+/* main oscillator; full sleep else (OFF), only the inputs and the Timer1 */
+/* crystal count then. The Timer2 period after the last byte wakes the    */
+/* core to choose again.                                                  */
+#define APP_SLEEP()  \
+do{ InterruptHandler_DisableGlobalInterrupt();                           \
+    while(AppEventFlag==FALSE){                                          \
+          OSCCON.IDLEN=(App_TickPeriod != 0 || LcdQueue_isEmpty()==FALSE); \
+          Sleep();                                                       \
+          InterruptHandler_EnbleGlobalInterrupt(); /* Routines of the wake up */ \
+          InterruptHandler_DisableGlobalInterrupt(); }                   \
+    InterruptHandler_EnbleGlobalInterrupt();                             \
+  }while(0)
 
 
 
@@ -16,6 +16,9 @@
 #include "HAL_RegisterAccess.h"
 #include "HAL_GPIO.h"
 #include "HAL_Timer0.h"
+#include "HAL_Timer1.h"
+#include "HAL_Timer2.h"
+#include "HAL_Timer3.h"
 #include "HAL_InterruptHandler.h"
 
 #endif  /*_HAL_H_*/
\ No newline at end of file
@@ -1,33 +0,0 @@
-/*****************************************************************************/
-/** File:    Lcd_Config.h                                                   **/
-/**                                                                         **/
-/** Description: This file define all needed configurations for MikroC PRO  **/
-/**              for PIC build-in LCD driver.                               **/
-/**                                                                         **/
-/** Author:  Ahmed Wageh                                                    **/
-/**                                                                         **/
-/** Date:    24/2/2020                                                      **/
-/*****************************************************************************/
-
-#ifndef _LCD_CONFIG_H_
-#define _LCD_CONFIG_H_
-
-/* LCD configurations */
-// Lcd pinout settings
-sbit LCD_RS at RE2_bit;
-sbit LCD_EN at RE1_bit;
-sbit LCD_D7 at RD7_bit;
-sbit LCD_D6 at RD6_bit;
-sbit LCD_D5 at RD5_bit;
-sbit LCD_D4 at RD4_bit;
-
-// Pin direction
-sbit LCD_RS_Direction at TRISE2_bit;
-sbit LCD_EN_Direction at TRISE1_bit;
-sbit LCD_D7_Direction at TRISD7_bit;
-sbit LCD_D6_Direction at TRISD6_bit;
-sbit LCD_D5_Direction at TRISD5_bit;
-sbit LCD_D4_Direction at TRISD4_bit;
-
-
-#endif /* _LCD_CONFIG_H_ */
\ No newline at end of file
@@ -0,0 +1,46 @@
+/*****************************************************************************/
+/** File:    Pins_Config.h                                                  **/
+/**                                                                         **/
+/** Description: This file define the pins of all buttons, sensors and      **/
+/**              actuators for the compile-time GPIO pin API.               **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _PINS_CONFIG_H_
+#define _PINS_CONFIG_H_
+
+/* Inclusion */
+#include "HAL_GPIO.h"
+
+/* Pins definitions (port base address, pin number) */
+/* User buttons (pressed => LOW) */
+#define START_BUTTON_PIN     PORTB_BASE_ADDRESS,PIN_3
+#define CANCEL_BUTTON_PIN    PORTB_BASE_ADDRESS,PIN_4
+#define POWEROFF_BUTTON_PIN  PORTB_BASE_ADDRESS,PIN_5
+/* Sensors (food in / door closed => HIGH) */
+#define WEIGHT_SENSOR_PIN    PORTA_BASE_ADDRESS,PIN_3
+#define DOOR_SENSOR_PIN      PORTA_BASE_ADDRESS,PIN_2
+/* Actuators */
+#define HEATER_PIN           PORTB_BASE_ADDRESS,PIN_7
+#define LAMP_PIN             PORTB_BASE_ADDRESS,PIN_6
+#define MOTOR_PIN            PORTC_BASE_ADDRESS,PIN_2
+#define BUZZER_PIN           PORTC_BASE_ADDRESS,PIN_1  /* Buzzer on => LOW */
+/* LCD 4 bits bus */
+#define LCD_RS_PIN           PORTE_BASE_ADDRESS,PIN_2
+#define LCD_EN_PIN           PORTE_BASE_ADDRESS,PIN_1
+#define LCD_D4_PIN           PORTD_BASE_ADDRESS,PIN_4  /* D5..D7 on the next pins */
+/* LCD R/W: TRUE => wired to LCD_RW_PIN and the busy flag is read,         */
+/*          FALSE => tied LOW and the worst-case execution times are waited */
+#ifndef LCD_RW_WIRED
+#define LCD_RW_WIRED         FALSE
+#endif
+#define LCD_RW_PIN           PORTE_BASE_ADDRESS,PIN_0
+
+/* Ports of the buttons and sensors, latched once per pass */
+#define INPUT_PORTS_MASK     (GPIO_PORT_MASK(PORTA_BASE_ADDRESS) | \
+                              GPIO_PORT_MASK(PORTB_BASE_ADDRESS))
+
+#endif /* _PINS_CONFIG_H_ */
@@ -0,0 +1,35 @@
+/*****************************************************************************/
+/** File:    Profile_Config.h                                               **/
+/**                                                                         **/
+/** Description: This file define the compile-time configuration of the    **/
+/**              profiler: the build switch, the named regions and the      **/
+/**              histograms bins.                                           **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _PROFILE_CONFIG_H_
+#define _PROFILE_CONFIG_H_
+
+/* Profile Configurations */
+/* Debug build: TRUE. Release: FALSE, the probes expand to nothing and   */
+/* Timer3 is left free.                                                  */
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE  FALSE
+#endif
+
+/* Named regions, PROFILE_REGION_NAMES in the same order */
+#define PROFILE_EDIT_MODE       0   /* APP_Edit_Mode() */
+#define PROFILE_KEYPAD_SCAN     1   /* Keypad_update(), Timer0 callback */
+#define PROFILE_REGIONS_NUMBER  2
+#define PROFILE_REGION_NAMES    {"Edit","KeyScan"}
+
+/* Histograms: PROFILE_BINS bins of 2^SHIFT Tcy, the last bin takes the */
+/* longer ones.                                                         */
+#define PROFILE_BINS               8
+#define PROFILE_LATENCY_BIN_SHIFT  3   /* 8 Tcy (4 us) */
+#define PROFILE_ISR_BIN_SHIFT      6   /* 64 Tcy (32 us) */
+
+#endif /* _PROFILE_CONFIG_H_ */
@@ -0,0 +1,24 @@
+/*****************************************************************************/
+/** File:    Timer0_Config.h                                                **/
+/**                                                                         **/
+/** Description: This file define the compile-time configuration of Timer0, **/
+/**              HAL_Timer0.h works out the prescaler, T0CON and reload.    **/
+/**                                                                         **/
+/** Author:  Ahmed Wageh                                                    **/
+/**                                                                         **/
+/** Date:    16/10/2026                                                     **/
+/*****************************************************************************/
+
+#ifndef _TIMER0_CONFIG_H_
+#define _TIMER0_CONFIG_H_
+
+/* Timer0 Configurations */
+#define TIMER0_CONFIG_FOSC_HZ        8000000UL /* HS crystal of the board */
+#define TIMER0_CONFIG_PERIOD_US      25000UL   /* Tick: debounce, keypad scan */
+/* Longest period HAL_Timer0_extend stretches a tick to: the tickless     */
+/* Edit, Run and Notification period, up to the poll of Start and the     */
+/* sensors. It sets the prescaler of that period only, the tick keeps its */
+/* own (off up to 32.768 ms at 8 MHz, drift free reload).                 */
+#define TIMER0_CONFIG_MAX_PERIOD_US  100000UL
+
+#endif /* _TIMER0_CONFIG_H_ */
@@ -12,37 +12,63 @@
 #include "StdTypes.h"
 #include "HAL_RegisterAccess.h"
 #include "HAL_GPIO.h"
+#include "Pins_Config.h"
 #include "HAL_InterruptHandler.h"
 #include "HAL_Timer0.h"
+#include "HAL_Timer1.h"
 #include "Module_Keypad.h"
-#include "App_Functions.h"
+#include "Module_LcdBuffer.h"
+#include "Module_SoftTimer.h"
+#include "Module_Profile.h"
+#include "APP_Functions.h"
 
 /*  variables defination */
 /* Define Modules */
 /* User buttons */
-HAL_GPIO_DeviceType Start_Button  = {PORTB_BASE_ADDRESS,PIN_3,INPUT};
-HAL_GPIO_DeviceType Cancel_Button = {PORTB_BASE_ADDRESS,PIN_4,INPUT};
-HAL_GPIO_DeviceType PowerOFF_Button = {PORTB_BASE_ADDRESS,PIN_5,INPUT};
+HAL_GPIO_DeviceType Start_Button  = {START_BUTTON_PIN,INPUT};
+HAL_GPIO_DeviceType Cancel_Button = {CANCEL_BUTTON_PIN,INPUT};
+HAL_GPIO_DeviceType PowerOFF_Button = {POWEROFF_BUTTON_PIN,INPUT};
 /* Sensors */
-HAL_GPIO_DeviceType Weight_Sensor  = {PORTA_BASE_ADDRESS,PIN_3,INPUT};
-HAL_GPIO_DeviceType Door_Sensor    = {PORTA_BASE_ADDRESS,PIN_2,INPUT};
+HAL_GPIO_DeviceType Weight_Sensor  = {WEIGHT_SENSOR_PIN,INPUT};
+HAL_GPIO_DeviceType Door_Sensor    = {DOOR_SENSOR_PIN,INPUT};
 /* Actuators */
-HAL_GPIO_DeviceType Heater  = {PORTB_BASE_ADDRESS,PIN_7,OUTPUT};
-HAL_GPIO_DeviceType Lamp    = {PORTB_BASE_ADDRESS,PIN_6,OUTPUT};
-HAL_GPIO_DeviceType Motor   = {PORTC_BASE_ADDRESS,PIN_2,OUTPUT};
-HAL_GPIO_DeviceType Buzzer  = {PORTC_BASE_ADDRESS,PIN_1,OUTPUT};
+HAL_GPIO_DeviceType Heater  = {HEATER_PIN,OUTPUT};
+HAL_GPIO_DeviceType Lamp    = {LAMP_PIN,OUTPUT};
+HAL_GPIO_DeviceType Motor   = {MOTOR_PIN,OUTPUT};
+HAL_GPIO_DeviceType Buzzer  = {BUZZER_PIN,OUTPUT};
+/* Pins are accessed by the compile-time pin API, check them once here */
+GPIO_PIN_CHECK(Start_Button,START_BUTTON_PIN);
+GPIO_PIN_CHECK(Cancel_Button,CANCEL_BUTTON_PIN);
+GPIO_PIN_CHECK(PowerOFF_Button,POWEROFF_BUTTON_PIN);
+GPIO_PIN_CHECK(Weight_Sensor,WEIGHT_SENSOR_PIN);
+GPIO_PIN_CHECK(Door_Sensor,DOOR_SENSOR_PIN);
+GPIO_PIN_CHECK(Heater,HEATER_PIN);
+GPIO_PIN_CHECK(Lamp,LAMP_PIN);
+GPIO_PIN_CHECK(Motor,MOTOR_PIN);
+GPIO_PIN_CHECK(Buzzer,BUZZER_PIN);
+/* Actuators switched together, one masked write per port */
+HAL_GPIO_DeviceType * const Cooking_Devices[]={&Lamp,&Heater,&Motor};
+HAL_GPIO_DeviceType * const Done_Devices[]   ={&Lamp,&Heater,&Motor,&Buzzer};
+HAL_GPIO_GroupType Cooking_Group;
+HAL_GPIO_GroupType Done_Group;
 /* Timer Configurations */
-HAL_Timer0_ConfigType Timer0_Configurations ={
-          TIMER0_TIMER,
-          TIMER0_16_BITS,
-          TIMER0_PRESCALER_16,
-          62411 /* Overflow every 25 ms */
+/* Timer0 input sampling is the compile-time configuration of Timer0_Config.h */
+/* Timebase of the software timers, counts and wakes up in sleep */
+HAL_Timer1_ConfigType Timer1_Configurations ={
+          TIMER1_OSCILLATOR,
+          TIMER1_PRESCALER_OFF, /* Reload set in TMR1H, no drift */
+          APP_RTC_RELOAD /* Overflow every 500 ms (16384 counts) */
 };
 /* Define variables */
 APP_stateType ProgramState= APP_OFF_STATE; /* For holding the state of Application */
-uint8 TimerIntCounter=0;
+SoftTimer_Type App_SecondTimer; /* Countdown, every second while cooking */
+SoftTimer_Type App_BuzzerTimer; /* Buzzer toggle in notification */
+uint8 InputChangeFlag=FALSE; /* Set by the input interrupts */
+uint8 AppEventFlag=FALSE;    /* Set by every interrupt except the LCD periods */
+uint8 InputWakeArmed=FALSE;  /* Inputs wake the CPU, Start and sensors polled */
+uint8 App_TickPeriod=1;      /* Ticks of the Timer0 period which runs now, */
+                             /* 0 while Timer0 is stopped (OFF)            */
 Time_DataType App_Time={0,0,0};
-HAL_GPIO_StatusType Input_Reading;
 keypad_returnDataType Keypad_Reading=KEYPAD_NOT_PRESSED;
 uint8 Edit_Position=0; /* To indicate which digit is being editted now */
                        /* 0 => first  digit of hours */
@@ -69,37 +95,80 @@ void APP_Init(void)
       GPIO_DeviceInit(&Lamp);
       GPIO_DeviceInit(&Motor);
       GPIO_DeviceInit(&Buzzer);
-      GPIO_DeviceSet(&Buzzer);
+      GPIO_PIN_SET(BUZZER_PIN);
+      GPIO_GroupInit(&Cooking_Group,Cooking_Devices,sizeof(Cooking_Devices)/sizeof(Cooking_Devices[0]));
+      GPIO_GroupInit(&Done_Group,Done_Devices,sizeof(Done_Devices)/sizeof(Done_Devices[0]));
       /* Keypad and LCD Initialization */
       Keypad_init(&Keypad1);
-      Lcd_Init();
-      Lcd_Cmd(_LCD_CURSOR_OFF);
+      Hd44780_init(); /* Cursor off */
+      /* Buttons are debounced every timer tick */
+      Debounce_init(INPUT_PORTS_MASK);
+      LcdBuffer_init(); /* The app writes the LCD through its frame buffer */
+      /* A key pulls its column LOW, wake on the press */
+      InterruptHandler_SetEdge(INT_EXT0,INT_FALLING_EDGE);
+      InterruptHandler_SetEdge(INT_EXT1,INT_FALLING_EDGE);
+      InterruptHandler_SetEdge(INT_EXT2,INT_FALLING_EDGE);
       /* Timer Initialization */
-      HAL_Timer0_init(&Timer0_Configurations);
+      HAL_Timer0_initStatic();
       InterruptHandler_EnableInterrupt(INT_TMR0);
+      /* The crystal starts up now, Timer1 counts from the first Run */
+      HAL_Timer1_init(&Timer1_Configurations);
+      PROFILE_INIT(); /* Debug build: Timer3 counts Tcy for the probes */
 }
 
-/* This function to update Time on LCD. */
+/* This function to update Time on LCD, a BCD nibble is one digit. */
 void APP_Timeupdate(Time_DataType * Time_Data)
 {
-      Lcd_Chr(1,6,(Time_Data->hours/10)+'0');
-      Lcd_Chr(1,7,(Time_Data->hours%10)+'0');
-      Lcd_Chr(1,8,':');
-      Lcd_Chr(1,9,(Time_Data->minutes/10)+'0');
-      Lcd_Chr(1,10,(Time_Data->minutes%10)+'0');
-      Lcd_Chr(1,11,':');
-      Lcd_Chr(1,12,(Time_Data->seconds/10)+'0');
-      Lcd_Chr(1,13,(Time_Data->seconds%10)+'0');
+      LcdBuffer_chr(1,6,(Time_Data->hours>>4)+'0');
+      LcdBuffer_chr(1,7,(Time_Data->hours&0x0F)+'0');
+      LcdBuffer_chr(1,8,':');
+      LcdBuffer_chr(1,9,(Time_Data->minutes>>4)+'0');
+      LcdBuffer_chr(1,10,(Time_Data->minutes&0x0F)+'0');
+      LcdBuffer_chr(1,11,':');
+      LcdBuffer_chr(1,12,(Time_Data->seconds>>4)+'0');
+      LcdBuffer_chr(1,13,(Time_Data->seconds&0x0F)+'0');
+}
+
+/* This function counts the BCD time down by one second. */
+/* A field at 0x00 borrows from the next one and reloads 0x59, x0 goes  */
+/* to (x-1)9 by -7 (0x10-7 = 0x09), any other value by -1.              */
+uint8 APP_TimeDecrement(Time_DataType * Time_Data)
+{
+      if(Time_Data->seconds != 0x00)
+      {
+            Time_Data->seconds-=((Time_Data->seconds & 0x0F) == 0) ? 7 : 1;
+      }
+      else if(Time_Data->minutes != 0x00)
+      {
+            Time_Data->seconds=0x59;
+            Time_Data->minutes-=((Time_Data->minutes & 0x0F) == 0) ? 7 : 1;
+      }
+      else if(Time_Data->hours != 0x00)
+      {
+            Time_Data->seconds=0x59;
+            Time_Data->minutes=0x59;
+            Time_Data->hours-=((Time_Data->hours & 0x0F) == 0) ? 7 : 1;
+      }
+      return (Time_Data->hours | Time_Data->minutes | Time_Data->seconds) == 0x00;
 }
 
 void APP_Off_Mode(void)
 {
-      Lcd_Cmd(_LCD_CLEAR); /* Clear LCD */
+      LcdBuffer_clear(); /* Clear LCD */
+      APP_InputWake_Stop(); /* Next wake up starts with the 25 ms tick */
       HAL_Timer0_stop(); /* Disable Timer */
+      App_TickPeriod=0;  /* Full sleep, the main oscillator stops */
       /* Disable timer0 interrupt */
       InterruptHandler_DisableInterrupt(INT_TMR0);
-      TimerIntCounter=0; /* Reset Timer counter */
-      /* Enable External Interrupts to wake from sleep */
+      /* Stop software timers and their timebase */
+      SoftTimer_stop(&App_SecondTimer);
+      SoftTimer_stop(&App_BuzzerTimer);
+      HAL_Timer1_stop();
+      InterruptHandler_DisableInterrupt(INT_TMR1);
+      /* Enable External Interrupts to wake from sleep, drop old edges */
+      InterruptHandler_ClearFlag(INT_EXT0);
+      InterruptHandler_ClearFlag(INT_EXT1);
+      InterruptHandler_ClearFlag(INT_EXT2);
       InterruptHandler_EnableInterrupt(INT_EXT0);
       InterruptHandler_EnableInterrupt(INT_EXT1);
       InterruptHandler_EnableInterrupt(INT_EXT2);
@@ -109,140 +178,132 @@ void APP_WakeUp_Mode(void)
 {
       /* Enable Timer */
       HAL_Timer0_start();
+      App_TickPeriod=1;  /* Idle, Timer0 counts in sleep */
       /* Enable timer0 interrupt */
       InterruptHandler_EnableInterrupt(INT_TMR0);
       /* Disable External Interrupt */
       InterruptHandler_DisableInterrupt(INT_EXT0);
       InterruptHandler_DisableInterrupt(INT_EXT1);
       InterruptHandler_DisableInterrupt(INT_EXT2);
+      /* Inputs changed while sleeping are not presses */
+      Debounce_reset();
+      Keypad_sync(&Keypad1);
+      InputChangeFlag=FALSE;
       /* Print screen layout */
-      Lcd_Out(1,1,"Time:");
-      Lcd_Out(2,1,"Microwave:");
-      Lcd_Out(3,-3,"Door:    Food:   ");
-      Lcd_Out(4,-3,"Error:");
-      /* 4*16 LCD startposition of Row 3 and 4 is at col -3 */
-      Lcd_Out(2,11,"Edit ");
+      LcdBuffer_out(1,1,"Time:");
+      LcdBuffer_out(2,1,"Microwave:");
+      LcdBuffer_out(3,1,"Door:    Food:  ");
+      LcdBuffer_out(4,1,"Error:");
+      LcdBuffer_out(2,11,"Edit ");
+      LcdBuffer_flush();
       ProgramState = APP_EDIT_STATE; /* Edit state */
 }
 
 void APP_Edit_Mode(void)
 {
+      /* Latch sensors and button presses once for this pass */
+      GPIO_SnapshotTake(INPUT_PORTS_MASK);
+      Debounce_takeEvents();
       /* Update time on LCD */
       APP_Timeupdate(&App_Time);
       /* Check start button */
-      GPIO_DeviceGetRead(&Start_Button,&Input_Reading);
-      if(Input_Reading==LOW)   /* User pressed start*/
+      if(DEBOUNCE_PIN_FELL(START_BUTTON_PIN))   /* User pressed start*/
       {
-             /* Debouncing */
-             HAL_GPIO_DEBOUNCE(Start_Button.devicePortBaseAddress,Start_Button.devicePin,LOW);
              /* Start button check  */
-             if(App_Time.hours == 0   &&
-                App_Time.minutes == 0 &&
-                App_Time.seconds == 0 ) /* Time not set */
+             if((App_Time.hours | App_Time.minutes | App_Time.seconds) == 0x00) /* Time not set */
              {
-                    Lcd_Out(4,3,"TimeNotSet");
+                    LcdBuffer_out(4,7,"TimeNotSet");
              }
              else
              {
-                    GPIO_DeviceGetRead(&Weight_Sensor,&Input_Reading);
-                    if(Input_Reading==HIGH) /* Food in Microwave */
+                    if(GPIO_SNAPSHOT_READ(WEIGHT_SENSOR_PIN)==HIGH) /* Food in Microwave */
                     {
-                         GPIO_DeviceGetRead(&Door_Sensor,&Input_Reading);
-                         if(Input_Reading==HIGH) /* Door closed */
+                         if(GPIO_SNAPSHOT_READ(DOOR_SENSOR_PIN)==HIGH) /* Door closed */
                          {
-                                 Lcd_Out(2,11,"Run  ");
-                                 Lcd_Out(4,3,"          ");
-                                 TimerIntCounter=0;
+                                 LcdBuffer_out(2,11,"Run  ");
+                                 LcdBuffer_out(4,7,"          ");
 
-                                 HAL_Timer0_stop();
-                                 /* Reload Timer */
-                                 TMR0L=Timer0_Configurations.Timer0_Data&0x0F;
-                                 TMR0H=Timer0_Configurations.Timer0_Data>>8;
-
-                                 HAL_Timer0_start();
-                                 /* Enable timer0 interrupt */
-                                 InterruptHandler_EnableInterrupt(INT_TMR0);
+                                 /* Restart Timer1, the first second is a full one */
+                                 HAL_Timer1_updateConfig(&Timer1_Configurations);
+                                 SoftTimer_start(&App_SecondTimer,APP_SECOND_TICKS,APP_SECOND_TICKS);
+                                 /* Enable timer1 interrupt */
+                                 InterruptHandler_ClearFlag(INT_TMR1);
+                                 InterruptHandler_EnableInterrupt(INT_TMR1);
 
                                  /*  Lamp is ON, Heater is ON and Motor is ON */
-                                 GPIO_DeviceSet(&Lamp);
-                                 GPIO_DeviceSet(&Heater);
-                                 GPIO_DeviceSet(&Motor);
+                                 GPIO_GroupSet(&Cooking_Group);
 
                                  ProgramState = APP_RUNNING_STATE;
                          }
                          else
                          {
-                                 Lcd_Out(4,3,"Close Door");
+                                 LcdBuffer_out(4,7,"Close Door");
                          }
                     }
                     else
                     {
-                          Lcd_Out(4,3,"PutFoodIn ");
+                          LcdBuffer_out(4,7,"PutFoodIn ");
                     }
              }
       }
       /* Check Cancel button */
-      GPIO_DeviceGetRead(&Cancel_Button,&Input_Reading);
-      if(Input_Reading==LOW)  /* Cancel button pressed */
+      if(DEBOUNCE_PIN_FELL(CANCEL_BUTTON_PIN))  /* Cancel button pressed */
       {
-             /* Debouncing */
-             HAL_GPIO_DEBOUNCE(Cancel_Button.devicePortBaseAddress,Cancel_Button.devicePin,LOW);
              App_Time.hours = 0;
              App_Time.minutes = 0;
              App_Time.seconds = 0;
       }
 
       /* Check Door and  food sensors */
-      GPIO_DeviceGetRead(&Weight_Sensor,&Input_Reading);
-      if(Input_Reading==HIGH)  /* Food in */
+      if(GPIO_SNAPSHOT_READ(WEIGHT_SENSOR_PIN)==HIGH)  /* Food in */
       {
-             Lcd_Out(3,11,"OK  ");
+             LcdBuffer_out(3,15,"OK");
       }
       else
       {
-             Lcd_Out(3,11,"NO  ");
+             LcdBuffer_out(3,15,"NO");
       }
-      GPIO_DeviceGetRead(&Door_Sensor,&Input_Reading);
-      if(Input_Reading==HIGH) /* Door Closed */
+      if(GPIO_SNAPSHOT_READ(DOOR_SENSOR_PIN)==HIGH) /* Door Closed */
       {
-             Lcd_Out(3,2,"OK  ");
+             LcdBuffer_out(3,6,"OK  ");
       }
       else
       {
-             Lcd_Out(3,2,"NO ");
+             LcdBuffer_out(3,6,"NO ");
       }
 
-      /* Keypad check */
+      /* Keypad check, every key queued since the last pass */
       Keypad_getReading(&Keypad1,&Keypad_Reading);
-      if(Keypad_Reading !=  KEYPAD_NOT_PRESSED)
+      while(Keypad_Reading !=  KEYPAD_NOT_PRESSED)
       {
             if(Keypad_Reading >= '0' && Keypad_Reading <= '9')
             {
                  switch(Edit_Position)
                  {
+                     /* The key sets one nibble of the BCD field */
                      case 0:
-                          App_Time.hours = (App_Time.hours%10) + (Keypad_Reading-'0')*10;
+                          App_Time.hours = (App_Time.hours & 0x0F) | ((Keypad_Reading-'0')<<4);
                      break;
                      case 1:
-                          App_Time.hours = App_Time.hours - (App_Time.hours%10) + (Keypad_Reading-'0');
+                          App_Time.hours = (App_Time.hours & 0xF0) | (Keypad_Reading-'0');
                      break;
                      case 2:
                           if(Keypad_Reading < '6') /* Minutes must be less than 60 */
                           {
-                              App_Time.minutes = (App_Time.minutes%10) + (Keypad_Reading-'0')*10;
+                              App_Time.minutes = (App_Time.minutes & 0x0F) | ((Keypad_Reading-'0')<<4);
                           }
                      break;
                      case 3:
-                          App_Time.minutes = App_Time.minutes - (App_Time.minutes%10) + (Keypad_Reading-'0');
+                          App_Time.minutes = (App_Time.minutes & 0xF0) | (Keypad_Reading-'0');
                      break;
                      case 4:
                           if(Keypad_Reading < '6') /* Seconds must be less than 60 */
                           {
-                              App_Time.seconds = (App_Time.seconds%10) + (Keypad_Reading-'0')*10;
+                              App_Time.seconds = (App_Time.seconds & 0x0F) | ((Keypad_Reading-'0')<<4);
                           }
                      break;
                      case 5:
-                          App_Time.seconds = App_Time.seconds - (App_Time.seconds%10) + (Keypad_Reading-'0');
+                          App_Time.seconds = (App_Time.seconds & 0xF0) | (Keypad_Reading-'0');
                      break;
 
                  }
@@ -257,60 +318,114 @@ void APP_Edit_Mode(void)
                  Edit_Position ++;
                  if(Edit_Position  > 5) Edit_Position=0;
             }
+            Keypad_getReading(&Keypad1,&Keypad_Reading);
       }
       
       /* Check Power buttons */
-      GPIO_DeviceGetRead(&PowerOFF_Button,&Input_Reading);
-      if(Input_Reading== LOW) /* Power Off Button is pressed */
+      if(DEBOUNCE_PIN_FELL(POWEROFF_BUTTON_PIN)) /* Power Off Button is pressed */
       {
-           /* Debouncing */
-           HAL_GPIO_DEBOUNCE(PowerOFF_Button.devicePortBaseAddress,PowerOFF_Button.devicePin,LOW);
            /* Reset row pins again */
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[0]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[1]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[2]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[3]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[0]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[1]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[2]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[3]));
 
            /* Turn OFF Buzzer */
-           GPIO_DeviceSet(&Buzzer);
+           GPIO_PIN_SET(BUZZER_PIN);
            ProgramState = APP_OFF_STATE;
       }
+
+      /* Send the changed characters of this pass */
+      LcdBuffer_flush();
+
+      /* The next state sets its own wake up (APP_Off_Mode, Run) */
+      if(ProgramState != APP_EDIT_STATE)      return;
+
+      /* Sleep up to the next poll while no input is moving */
+      APP_InputWake_Update();
+      APP_Tickless_Update();
+}
+
+/* This function arms or disarms the input change wake. */
+void APP_InputWake_Update(void)
+{
+#if APP_INPUT_WAKE
+      if(InputChangeFlag == TRUE          ||
+         Debounce_isSettled() == FALSE    ||
+         Keypad_isIdle(&Keypad1) == FALSE)  /* Input moving, debounce it */
+      {
+            InputChangeFlag=FALSE;
+            APP_InputWake_Stop();
+      }
+      else if(InputWakeArmed == FALSE)
+      {
+            /* Rows are LOW, a key press wakes through its column */
+            InterruptHandler_ClearFlag(INT_EXT0);
+            InterruptHandler_ClearFlag(INT_EXT1);
+            InterruptHandler_ClearFlag(INT_EXT2);
+            InterruptHandler_ClearFlag(INT_RB);
+            InterruptHandler_EnableInterrupt(INT_EXT0);
+            InterruptHandler_EnableInterrupt(INT_EXT1);
+            InterruptHandler_EnableInterrupt(INT_EXT2);
+            InterruptHandler_EnableInterrupt(INT_RB);
+            InputWakeArmed=TRUE;
+      }
+#endif
+}
+
+/* This function disarms the input change wake, back to the 25 ms tick. */
+void APP_InputWake_Stop(void)
+{
+#if APP_INPUT_WAKE
+      if(InputWakeArmed == TRUE)
+      {
+            InterruptHandler_DisableInterrupt(INT_EXT0);
+            InterruptHandler_DisableInterrupt(INT_EXT1);
+            InterruptHandler_DisableInterrupt(INT_EXT2);
+            InterruptHandler_DisableInterrupt(INT_RB);
+            InputWakeArmed=FALSE;
+      }
+      InterruptHandler_DisableGlobalInterrupt();
+      if(App_TickPeriod > 1) /* Sample the input in one tick, not at the poll */
+      {
+            HAL_Timer0_initStatic();
+            HAL_Timer0_start();
+            App_TickPeriod=1;
+      }
+      InterruptHandler_EnbleGlobalInterrupt();
+#endif
+}
+
+/* This function extends Timer0 up to the next poll. */
+void APP_Tickless_Update(void)
+{
+      if(InputWakeArmed == FALSE)      return; /* Inputs sampled every tick */
+
+      InterruptHandler_DisableGlobalInterrupt();
+      /* Once per period, and not if it already ended (interrupt pending) */
+      if(App_TickPeriod == 1 && INTCON.TMR0IF == FALSE)
+      {
+            HAL_Timer0_extend((APP_POLL_TICKS-1)*TIMER0_CONFIG_PERIOD_TCY);
+            App_TickPeriod=APP_POLL_TICKS;
+      }
+      InterruptHandler_EnbleGlobalInterrupt();
 }
 
 void APP_Run_Mode(void)
 {
-      if(TimerIntCounter >= 40) /* 1 sec passed */
+      /* Latch sensors and button presses once for this pass */
+      GPIO_SnapshotTake(INPUT_PORTS_MASK);
+      Debounce_takeEvents();
+      Keypad_flush(&Keypad1); /* Keys are not used while cooking */
+      if(SoftTimer_expired(&App_SecondTimer)) /* 1 sec passed */
       {
-          TimerIntCounter = 0;
-          if(App_Time.seconds>0)
+          if(APP_TimeDecrement(&App_Time) == TRUE) /* 00:00:00 reached */
           {
-              App_Time.seconds--;
-          }
-          else if(App_Time.seconds==0)
-          {
-              App_Time.seconds=59;
-              if(App_Time.minutes>0)
-              {
-                  App_Time.minutes--;
-              }
-              else
-              {
-                  App_Time.minutes=59;
-                  if(App_Time.hours>0) App_Time.hours--;
-              }
-          }
-                  
-                  if(App_Time.seconds==0 && App_Time.minutes==0 && App_Time.hours==0)
-          {
-                Lcd_Out(2,11,"Done ");
-
-                /*  Lamp is OFF, Heater is OFF and Motor is OFF */
-                GPIO_DeviceClear(&Lamp);
-                GPIO_DeviceClear(&Heater);
-                GPIO_DeviceClear(&Motor);
+                LcdBuffer_out(2,11,"Done ");
 
-                /* Turn Buzzer ON */
-                GPIO_DeviceClear(&Buzzer);
+                /*  Lamp is OFF, Heater is OFF, Motor is OFF and Buzzer is ON (LOW) */
+                GPIO_GroupClear(&Done_Group);
+                SoftTimer_start(&App_BuzzerTimer,APP_BUZZER_TICKS,APP_BUZZER_TICKS);
 
                 ProgramState =  APP_NOTIFICATION_STATE;
           }
@@ -321,163 +436,174 @@ void APP_Run_Mode(void)
       APP_Timeupdate(&App_Time);
 
       /* Check Cancel button */
-      GPIO_DeviceGetRead(&Cancel_Button,&Input_Reading);
-      if(Input_Reading==LOW)  /* Cancel button pressed */
+      if(DEBOUNCE_PIN_FELL(CANCEL_BUTTON_PIN))  /* Cancel button pressed */
       {
-             /* Debouncing */
-             HAL_GPIO_DEBOUNCE(Cancel_Button.devicePortBaseAddress,Cancel_Button.devicePin,LOW);
              
-             Lcd_Out(2,11,"Edit ");
+             LcdBuffer_out(2,11,"Edit ");
 
              /*  Lamp is OFF, Heater is OFF and Motor is OFF */
-             GPIO_DeviceClear(&Lamp);
-             GPIO_DeviceClear(&Heater);
-             GPIO_DeviceClear(&Motor);
+             GPIO_GroupClear(&Cooking_Group);
 
              ProgramState = APP_EDIT_STATE; /* Edit state */
       }
 
       /* Check Door and  food sensors */
-      GPIO_DeviceGetRead(&Weight_Sensor,&Input_Reading);
-      if(Input_Reading==HIGH)  /* Food in */
+      if(GPIO_SNAPSHOT_READ(WEIGHT_SENSOR_PIN)==HIGH)  /* Food in */
       {
-             Lcd_Out(3,11,"OK  ");
+             LcdBuffer_out(3,15,"OK");
       }
       else
       {
-             Lcd_Out(3,11,"NO  ");
-             Lcd_Out(2,11,"Edit ");
+             LcdBuffer_out(3,15,"NO");
+             LcdBuffer_out(2,11,"Edit ");
 
              /*  Lamp is OFF, Heater is OFF and Motor is OFF */
-             GPIO_DeviceClear(&Lamp);
-             GPIO_DeviceClear(&Heater);
-             GPIO_DeviceClear(&Motor);
+             GPIO_GroupClear(&Cooking_Group);
 
              ProgramState = APP_EDIT_STATE; /* Edit state */
       }
-      GPIO_DeviceGetRead(&Door_Sensor,&Input_Reading);
-      if(Input_Reading==HIGH) /* Door Closed */
+      if(GPIO_SNAPSHOT_READ(DOOR_SENSOR_PIN)==HIGH) /* Door Closed */
       {
-             Lcd_Out(3,2,"OK  ");
+             LcdBuffer_out(3,6,"OK  ");
       }
       else
       {
-             Lcd_Out(3,2,"NO ");
-             Lcd_Out(2,11,"Edit ");
+             LcdBuffer_out(3,6,"NO ");
+             LcdBuffer_out(2,11,"Edit ");
 
              /*  Lamp is OFF, Heater is OFF and Motor is OFF */
-             GPIO_DeviceClear(&Lamp);
-             GPIO_DeviceClear(&Heater);
-             GPIO_DeviceClear(&Motor);
+             GPIO_GroupClear(&Cooking_Group);
 
              ProgramState = APP_EDIT_STATE; /* Edit state */
       }
       /* Check Power buttons */
-      GPIO_DeviceGetRead(&PowerOFF_Button,&Input_Reading);
-      if(Input_Reading== LOW) /* Power Off Button is pressed */
+      if(DEBOUNCE_PIN_FELL(POWEROFF_BUTTON_PIN)) /* Power Off Button is pressed */
       {
-           /* Debouncing */
-           HAL_GPIO_DEBOUNCE(PowerOFF_Button.devicePortBaseAddress,PowerOFF_Button.devicePin,LOW);
            /* Clear Time */
            App_Time.seconds=0;
            App_Time.minutes=0;
            App_Time.hours=0;
 
            /*  Lamp is OFF, Heater is OFF and Motor is OFF */
-           GPIO_DeviceClear(&Lamp);
-           GPIO_DeviceClear(&Heater);
-           GPIO_DeviceClear(&Motor);
+           GPIO_GroupClear(&Cooking_Group);
            
            /* Reset row pins again */
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[0]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[1]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[2]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[3]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[0]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[1]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[2]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[3]));
 
            /* Turn OFF Buzzer */
-           GPIO_DeviceSet(&Buzzer);
+           GPIO_PIN_SET(BUZZER_PIN);
            ProgramState = APP_OFF_STATE;
       }
+
+      /* Send the changed characters of this pass */
+      LcdBuffer_flush();
+
+      /* The countdown ends with the cooking */
+      if(ProgramState != APP_RUNNING_STATE) SoftTimer_stop(&App_SecondTimer);
+      /* APP_Off_Mode sets the wake up of OFF, don't arm Run's one */
+      if(ProgramState == APP_OFF_STATE)       return;
+      if(ProgramState == APP_EDIT_STATE) /* Back to the Timer0 polls */
+      {
+            HAL_Timer1_stop();
+            InterruptHandler_DisableInterrupt(INT_TMR1);
+      }
+      /* Sleep up to the next Timer1 tick or sensor poll while no input is */
+      /* moving, a change is debounced by 25 ms ticks up to its settle     */
+      APP_InputWake_Update();
+      APP_Tickless_Update();
 }
 
 void APP_Notification_Mode(void)
 {
-      if(TimerIntCounter >= 20) /* about .5 second passed */
+      /* Latch sensors and button presses once for this pass */
+      GPIO_SnapshotTake(INPUT_PORTS_MASK);
+      Debounce_takeEvents();
+      Keypad_flush(&Keypad1); /* Keys are not used in notification */
+      if(SoftTimer_expired(&App_BuzzerTimer)) /* .5 second passed */
       {
-           GPIO_DeviceToggle(&Buzzer);
-           TimerIntCounter = 0;
+           GPIO_PIN_TOGGLE(BUZZER_PIN);
       }
       /* Check Door and  food sensors */
-      GPIO_DeviceGetRead(&Weight_Sensor,&Input_Reading);
-      if(Input_Reading==HIGH)  /* Food in */
+      if(GPIO_SNAPSHOT_READ(WEIGHT_SENSOR_PIN)==HIGH)  /* Food in */
       {
-             Lcd_Out(3,11,"OK  ");
+             LcdBuffer_out(3,15,"OK");
       }
       else
       {
-             Lcd_Out(3,11,"NO  ");
+             LcdBuffer_out(3,15,"NO");
 
              /* Reset row pins again */
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[0]));
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[1]));
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[2]));
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[3]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[0]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[1]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[2]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[3]));
 
              /* Turn OFF Buzzer */
-             GPIO_DeviceSet(&Buzzer);
+             GPIO_PIN_SET(BUZZER_PIN);
 
              ProgramState = APP_OFF_STATE; /* Off state */
       }
-      GPIO_DeviceGetRead(&Door_Sensor,&Input_Reading);
-      if(Input_Reading==HIGH) /* Door Closed */
+      if(GPIO_SNAPSHOT_READ(DOOR_SENSOR_PIN)==HIGH) /* Door Closed */
       {
-             Lcd_Out(3,2,"OK  ");
+             LcdBuffer_out(3,6,"OK  ");
       }
       else
       {
-             Lcd_Out(3,2,"NO ");
+             LcdBuffer_out(3,6,"NO ");
 
              /* Reset row pins again */
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[0]));
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[1]));
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[2]));
-             GPIO_DeviceClear(&(Keypad1.rowConfiguration[3]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[0]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[1]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[2]));
+             GPIO_HandleClear(&(Keypad1.rowHandles[3]));
 
              /* Turn OFF Buzzer */
-             GPIO_DeviceSet(&Buzzer);
+             GPIO_PIN_SET(BUZZER_PIN);
 
              ProgramState = APP_OFF_STATE; /* Off state */
       }
       /* Check Power buttons */
-      GPIO_DeviceGetRead(&PowerOFF_Button,&Input_Reading);
-      if(Input_Reading== LOW) /* Power Off Button is pressed */
+      if(DEBOUNCE_PIN_FELL(POWEROFF_BUTTON_PIN)) /* Power Off Button is pressed */
       {
-           /* Debouncing */
-           HAL_GPIO_DEBOUNCE(PowerOFF_Button.devicePortBaseAddress,PowerOFF_Button.devicePin,LOW);
            /* Reset row pins again */
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[0]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[1]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[2]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[3]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[0]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[1]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[2]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[3]));
 
            /* Turn OFF Buzzer */
-           GPIO_DeviceSet(&Buzzer);
+           GPIO_PIN_SET(BUZZER_PIN);
            ProgramState = APP_OFF_STATE;
       }
 	  /* Check Cancel button */
-      GPIO_DeviceGetRead(&Cancel_Button,&Input_Reading);
-      if(Input_Reading==LOW)  /* Cancel button pressed */
+      if(DEBOUNCE_PIN_FELL(CANCEL_BUTTON_PIN))  /* Cancel button pressed */
       {
-             /* Debouncing */
-             HAL_GPIO_DEBOUNCE(Cancel_Button.devicePortBaseAddress,Cancel_Button.devicePin,LOW);
              /* Reset row pins again */
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[0]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[1]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[2]));
-           GPIO_DeviceClear(&(Keypad1.rowConfiguration[3]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[0]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[1]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[2]));
+           GPIO_HandleClear(&(Keypad1.rowHandles[3]));
 
            /* Turn OFF Buzzer */
-           GPIO_DeviceSet(&Buzzer);
+           GPIO_PIN_SET(BUZZER_PIN);
            ProgramState = APP_OFF_STATE;
       }
+
+      /* Send the changed characters of this pass */
+      LcdBuffer_flush();
+
+      /* The buzzer cadence ends with the notification, APP_Off_Mode */
+      /* sets the wake up of OFF                                      */
+      if(ProgramState != APP_NOTIFICATION_STATE)
+      {
+            SoftTimer_stop(&App_BuzzerTimer);
+            return;
+      }
+
+      /* Sleep up to the next poll while no input is moving */
+      APP_InputWake_Update();
+      APP_Tickless_Update();
 }
\ No newline at end of file
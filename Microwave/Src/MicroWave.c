@@ -1,58 +1,87 @@
 #include "App.h"
 
+/* Interrupt callbacks, called by InterruptHandler_DispatchHigh/Low */
+static void App_TickCallback(void) /* Timer0 interrupt every 25 ms */
+{
+     PROFILE_TIMER0_LATENCY(); /* TMR0 counts from the overflow */
+     HAL_Timer0_reload(); /* First, it keeps the counts since the overflow */
+     App_TickPeriod=1; /* Next one is a tick unless main extends it */
+     AppEventFlag=TRUE;
+     Debounce_update(); /* Sample buttons, never waits */
+     PROFILE_ISR_BEGIN(PROFILE_KEYPAD_SCAN);
+     Keypad_update(&Keypad1); /* Scan keys and queue their events */
+     PROFILE_ISR_END(PROFILE_KEYPAD_SCAN);
+}
+
+static void App_RtcCallback(void) /* Timer1 crystal, every 500 ms in Run and Notification */
+{
+     HAL_Timer1_reload(); /* Exact while TMR1H is below the reload bits */
+     SoftTimer_advance(1); /* Countdown and buzzer */
+     AppEventFlag=TRUE;
+}
+
+static void App_InputCallback(void) /* Keypad columns INT1, INT2, Cancel and Power Off (RB) */
+{
+     APP_INPUT_CHANGED();
+}
+
+static void App_Column0Callback(void) /* Keypad column 0 (INT0), always high priority */
+{
+     APP_INPUT_CHANGED();
+}
+
 void main(){
+#if APP_INTERRUPT_PRIORITY
+     InterruptHandler_EnablePriority(); /* All low but INT0 */
+     InterruptHandler_SetPriority(INT_TMR0,INT_HIGH_PRIORITY);
+     InterruptHandler_SetPriority(INT_TMR1,INT_HIGH_PRIORITY);
+#endif
+     InterruptHandler_SetCallback(INT_TMR0,App_TickCallback);
+     InterruptHandler_SetCallback(INT_TMR1,App_RtcCallback);
+     InterruptHandler_SetCallback(INT_EXT0,App_Column0Callback);
+     InterruptHandler_SetCallback(INT_EXT1,App_InputCallback);
+     InterruptHandler_SetCallback(INT_EXT2,App_InputCallback);
+     InterruptHandler_SetCallback(INT_RB,App_InputCallback);
      APP_Init();
      while(TRUE){
+           AppEventFlag=FALSE; /* Events from here on start the next pass */
            switch(ProgramState)
            {
                  case APP_OFF_STATE:
                       APP_Off_Mode();
-                      Sleep(); /* Go to sleep */
+                      APP_SLEEP(); /* Go to sleep */
                  break;
                  case APP_WAKE_UP_STATE:
                       APP_WakeUp_Mode();
                  break;
                  case APP_EDIT_STATE:
+                      PROFILE_BEGIN(PROFILE_EDIT_MODE);
                       APP_Edit_Mode();
-                      Sleep(); /* Go to sleep */
+                      PROFILE_END(PROFILE_EDIT_MODE);
+                      APP_SLEEP(); /* Go to sleep */
                  break;
                  case APP_RUNNING_STATE:
                       APP_Run_Mode();
-                      Sleep(); /* Go to sleep */
+                      APP_SLEEP(); /* Go to sleep */
                  break;
                  case APP_NOTIFICATION_STATE:
                       APP_Notification_Mode();
-                      Sleep(); /* Go to sleep */
+                      APP_SLEEP(); /* Go to sleep */
                  break;
            }
      }
 }
 
-void interrupt(void)
+void interrupt(void) /* High priority, every source with APP_INTERRUPT_PRIORITY FALSE */
 {
-     if(INTCON.TMR0IF==TRUE) /* Timer0 interrupt every 20 ms */
-     {
-           INTCON.TMR0IF=FALSE;
-           TimerIntCounter++;
-           HAL_RegisterWrite(TIMER0L_Reg,Timer0_Configurations.Timer0_Data&0x0F);
-           HAL_RegisterWrite(TIMER0H_Reg,Timer0_Configurations.Timer0_Data>>8);
-     }
-     else if(INTCON.INT0IF==TRUE) /* Wake from sleep when APP_OFF_STATE */
-     {
-           INTCON.INT0IF=FALSE;
-           HAL_GPIO_DEBOUNCE(INT0_PORT,INT0_PIN,LOW);
-           ProgramState=APP_WAKE_UP_STATE;
-     }
-     else if(INTCON3.INT1IF==TRUE) /* Wake from sleep when APP_OFF_STATE */
-     {
-           INTCON3.INT1IF=FALSE;
-           HAL_GPIO_DEBOUNCE(INT1_PORT,INT1_PIN,LOW);
-           ProgramState=APP_WAKE_UP_STATE;
-     }
-     else if(INTCON3.INT2IF==TRUE) /* Wake from sleep when APP_OFF_STATE */
-     {
-           INTCON3.INT2IF=FALSE;
-           HAL_GPIO_DEBOUNCE(INT2_PORT,INT2_PIN,LOW);
-           ProgramState=APP_WAKE_UP_STATE;
-     }
-}
\ No newline at end of file
+     PROFILE_ISR_ENTRY();
+     InterruptHandler_DispatchHigh(); /* Pending sources only, flags cleared */
+     PROFILE_ISR_EXIT();
+}
+
+void interrupt_low(void) /* Low priority, the high one can interrupt it */
+{
+     PROFILE_ISR_LOW_ENTRY();
+     InterruptHandler_DispatchLow();
+     PROFILE_ISR_LOW_EXIT();
+}